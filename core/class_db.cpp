@@ -229,6 +229,9 @@ MethodDefinition D_METHOD(const char *p_name, const char *p_arg1, const char *p_
 #endif
 
 ClassDB::APIType ClassDB::current_api = API_CORE;
+std::atomic<uint32_t> ClassDB::method_table_version = { 1 };
+Mutex ClassDB::method_table_mutex;
+LocalVector<ClassDB::MethodTable *> ClassDB::retired_method_tables;
 
 void ClassDB::set_current_api(APIType p_api) {
 	current_api = p_api;
@@ -675,19 +678,67 @@ bool ClassDB::get_method_info(StringName p_class, StringName p_method, MethodInf
 	return false;
 }
 
+// Must be called with the class lock held for reading and method_table_mutex locked.
+ClassDB::MethodTable *ClassDB::_build_method_table(ClassInfo *p_type) {
+	MethodTable *table = memnew(MethodTable);
+	// Method maps only change under the write lock, so nothing is bound while building.
+	table->version = method_table_version.load(std::memory_order_acquire);
+
+	// Start from the class itself, so its methods take precedence over inherited ones.
+	for (ClassInfo *type = p_type; type; type = type->inherits_ptr) {
+		const StringName *K = nullptr;
+		while ((K = type->method_map.next(K))) {
+			MethodBind *method = type->method_map[*K];
+			if (method && !table->methods.has(*K)) {
+				table->methods[*K] = method;
+			}
+		}
+	}
+
+	// Other threads may still be reading the previous table, keep it around until cleanup().
+	MethodTable *previous = p_type->method_table.table.exchange(table, std::memory_order_acq_rel);
+	if (previous) {
+		retired_method_tables.push_back(previous);
+	}
+
+	return table;
+}
+
 MethodBind *ClassDB::get_method(StringName p_class, StringName p_name) {
+	// The lock may already be held for reading by this thread (e.g. from _validate_property()),
+	// so tables are built under a separate mutex rather than the write lock.
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return nullptr;
+	}
 
-	while (type) {
-		MethodBind **method = type->method_map.getptr(p_name);
-		if (method && *method) {
-			return *method;
+	MethodTable *table = type->method_table.table.load(std::memory_order_acquire);
+	if (!table || table->version != method_table_version.load(std::memory_order_acquire)) {
+		if (current_api != API_NONE) {
+			// Classes are still being registered and binding, a table would be outdated right away.
+			while (type) {
+				MethodBind **method = type->method_map.getptr(p_name);
+				if (method && *method) {
+					return *method;
+				}
+				type = type->inherits_ptr;
+			}
+			return nullptr;
+		}
+
+		MutexLock table_lock(method_table_mutex);
+
+		// Another thread may have built it while waiting for the mutex.
+		table = type->method_table.table.load(std::memory_order_acquire);
+		if (!table || table->version != method_table_version.load(std::memory_order_acquire)) {
+			table = _build_method_table(type);
 		}
-		type = type->inherits_ptr;
 	}
-	return nullptr;
+
+	MethodBind **method = table->methods.getptr(p_name);
+	return method ? *method : nullptr;
 }
 
 void ClassDB::bind_integer_constant(const StringName &p_class, const StringName &p_enum, const StringName &p_name, int p_constant) {
@@ -1088,45 +1139,47 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+			set_property_with_setget(p_object, psg, p_value, r_valid);
+			return true;
+		}
 
-			Callable::CallError ce;
+		check = check->inherits_ptr;
+	}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->call(psg->setter, arg, 2, ce);
-				}
+	return false;
+}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->call(psg->setter, arg, 1, ce);
-				}
-			}
+void ClassDB::set_property_with_setget(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid) {
+	if (!p_setget->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return; //do nothing
+	}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	Callable::CallError ce;
 
-			return true;
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[2] = { &index, &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->call(p_setget->setter, arg, 2, ce);
 		}
 
-		check = check->inherits_ptr;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->call(p_setget->setter, arg, 1, ce);
+		}
 	}
 
-	return false;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
@@ -1222,6 +1275,21 @@ Variant::Type ClassDB::get_property_type(const StringName &p_class, const String
 	return Variant::NIL;
 }
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_setter(StringName p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1338,6 +1406,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 #endif
 
 	type->method_map[mdname] = p_bind;
+	method_table_version++;
 
 	Vector<Variant> defvals;
 
@@ -1552,7 +1621,16 @@ void ClassDB::cleanup() {
 		while ((m = ti.method_map.next(m))) {
 			memdelete(ti.method_map[*m]);
 		}
+
+		MethodTable *table = ti.method_table.table.exchange(nullptr);
+		if (table) {
+			memdelete(table);
+		}
+	}
+	for (uint32_t i = 0; i < retired_method_tables.size(); i++) {
+		memdelete(retired_method_tables[i]);
 	}
+	retired_method_tables.clear();
 	classes.clear();
 	resource_base_extensions.clear();
 	compat_classes.clear();
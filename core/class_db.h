@@ -31,10 +31,13 @@
 #ifndef CLASS_DB_H
 #define CLASS_DB_H
 
+#include "core/local_vector.h"
 #include "core/method_bind.h"
 #include "core/object.h"
 #include "core/print_string.h"
 
+#include <atomic>
+
 /** To bind more then 6 parameters include this:
  *  #include "core/method_bind_ext.gen.inc"
  */
@@ -110,12 +113,30 @@ public:
 		Variant::Type type;
 	};
 
+	// Own and inherited methods of a class in a single table. Once published a table
+	// is never modified, a rebuild publishes a new one.
+	struct MethodTable {
+		HashMap<StringName, MethodBind *> methods;
+		uint32_t version = 0;
+	};
+
+	struct MethodTableRef {
+		std::atomic<MethodTable *> table = { nullptr };
+
+		// Copying a ClassInfo doesn't carry the table over, it's built again on demand.
+		MethodTableRef() {}
+		MethodTableRef(const MethodTableRef &) {}
+		MethodTableRef &operator=(const MethodTableRef &) { return *this; }
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
 		void *class_ptr = nullptr;
 
 		HashMap<StringName, MethodBind *> method_map;
+		// Built on first lookup once registration is over.
+		MethodTableRef method_table;
 		HashMap<StringName, int> constant_map;
 		HashMap<StringName, List<StringName>> enum_map;
 		HashMap<StringName, MethodInfo> signal_map;
@@ -158,6 +179,11 @@ public:
 #endif
 
 	static APIType current_api;
+	static std::atomic<uint32_t> method_table_version;
+	static Mutex method_table_mutex;
+	static LocalVector<MethodTable *> retired_method_tables;
+
+	static MethodTable *_build_method_table(ClassInfo *p_type);
 
 	static void _add_class2(const StringName &p_class, const StringName &p_inherits);
 
@@ -320,6 +346,7 @@ public:
 			ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 		}
 		type->method_map[p_name] = bind;
+		method_table_version++;
 #ifdef DEBUG_METHODS_ENABLED
 		// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 		//bind->set_return_type("Variant");
@@ -346,6 +373,9 @@ public:
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(StringName p_class, const StringName &p_property);
+	// Resolve a property setter once and call it directly, to avoid looking it up by name on every set.
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+	static void set_property_with_setget(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid = nullptr);
 	static StringName get_property_getter(StringName p_class, const StringName &p_property);
 
 	static bool has_method(StringName p_class, StringName p_method, bool p_no_inheritance = false);
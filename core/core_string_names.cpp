@@ -33,46 +33,46 @@
 CoreStringNames *CoreStringNames::singleton = nullptr;
 
 CoreStringNames::CoreStringNames() :
-		_free(StaticCString::create("free")),
-		changed(StaticCString::create("changed")),
-		_meta(StaticCString::create("__meta__")),
-		_script(StaticCString::create("script")),
-		script_changed(StaticCString::create("script_changed")),
-		___pdcdata(StaticCString::create("___pdcdata")),
-		__getvar(StaticCString::create("__getvar")),
-		_iter_init(StaticCString::create("_iter_init")),
-		_iter_next(StaticCString::create("_iter_next")),
-		_iter_get(StaticCString::create("_iter_get")),
-		get_rid(StaticCString::create("get_rid")),
-		_to_string(StaticCString::create("_to_string")),
+		_free(STATIC_SNAME("free")),
+		changed(STATIC_SNAME("changed")),
+		_meta(STATIC_SNAME("__meta__")),
+		_script(STATIC_SNAME("script")),
+		script_changed(STATIC_SNAME("script_changed")),
+		___pdcdata(STATIC_SNAME("___pdcdata")),
+		__getvar(STATIC_SNAME("__getvar")),
+		_iter_init(STATIC_SNAME("_iter_init")),
+		_iter_next(STATIC_SNAME("_iter_next")),
+		_iter_get(STATIC_SNAME("_iter_get")),
+		get_rid(STATIC_SNAME("get_rid")),
+		_to_string(STATIC_SNAME("_to_string")),
 #ifdef TOOLS_ENABLED
-		_sections_unfolded(StaticCString::create("_sections_unfolded")),
+		_sections_unfolded(STATIC_SNAME("_sections_unfolded")),
 #endif
-		_custom_features(StaticCString::create("_custom_features")),
-		x(StaticCString::create("x")),
-		y(StaticCString::create("y")),
-		z(StaticCString::create("z")),
-		w(StaticCString::create("w")),
-		r(StaticCString::create("r")),
-		g(StaticCString::create("g")),
-		b(StaticCString::create("b")),
-		a(StaticCString::create("a")),
-		position(StaticCString::create("position")),
-		size(StaticCString::create("size")),
-		end(StaticCString::create("end")),
-		basis(StaticCString::create("basis")),
-		origin(StaticCString::create("origin")),
-		normal(StaticCString::create("normal")),
-		d(StaticCString::create("d")),
-		h(StaticCString::create("h")),
-		s(StaticCString::create("s")),
-		v(StaticCString::create("v")),
-		r8(StaticCString::create("r8")),
-		g8(StaticCString::create("g8")),
-		b8(StaticCString::create("b8")),
-		a8(StaticCString::create("a8")),
-		call(StaticCString::create("call")),
-		call_deferred(StaticCString::create("call_deferred")),
-		emit(StaticCString::create("emit")),
-		notification(StaticCString::create("notification")) {
+		_custom_features(STATIC_SNAME("_custom_features")),
+		x(STATIC_SNAME("x")),
+		y(STATIC_SNAME("y")),
+		z(STATIC_SNAME("z")),
+		w(STATIC_SNAME("w")),
+		r(STATIC_SNAME("r")),
+		g(STATIC_SNAME("g")),
+		b(STATIC_SNAME("b")),
+		a(STATIC_SNAME("a")),
+		position(STATIC_SNAME("position")),
+		size(STATIC_SNAME("size")),
+		end(STATIC_SNAME("end")),
+		basis(STATIC_SNAME("basis")),
+		origin(STATIC_SNAME("origin")),
+		normal(STATIC_SNAME("normal")),
+		d(STATIC_SNAME("d")),
+		h(STATIC_SNAME("h")),
+		s(STATIC_SNAME("s")),
+		v(STATIC_SNAME("v")),
+		r8(STATIC_SNAME("r8")),
+		g8(STATIC_SNAME("g8")),
+		b8(STATIC_SNAME("b8")),
+		a8(STATIC_SNAME("a8")),
+		call(STATIC_SNAME("call")),
+		call_deferred(STATIC_SNAME("call_deferred")),
+		emit(STATIC_SNAME("emit")),
+		notification(STATIC_SNAME("notification")) {
 }
@@ -111,10 +111,12 @@ private:
 	void _unref(void *p_data);
 	void _ref(const CowData *p_from);
 	void _ref(const CowData &p_from);
+	void _move(CowData &p_from);
 	void _copy_on_write();
 
 public:
 	void operator=(const CowData<T> &p_from) { _ref(p_from); }
+	void operator=(CowData<T> &&p_from) { _move(p_from); }
 
 	_FORCE_INLINE_ T *ptrw() {
 		_copy_on_write();
@@ -184,6 +186,10 @@ public:
 	_FORCE_INLINE_ CowData() {}
 	_FORCE_INLINE_ ~CowData();
 	_FORCE_INLINE_ CowData(CowData<T> &p_from) { _ref(p_from); };
+	_FORCE_INLINE_ CowData(CowData<T> &&p_from) {
+		_ptr = p_from._ptr;
+		p_from._ptr = nullptr;
+	}
 };
 
 template <class T>
@@ -364,6 +370,26 @@ void CowData<T>::_ref(const CowData &p_from) {
 	}
 }
 
+// Takes over the reference held by p_from, leaving it empty. Unlike _ref(),
+// this touches no reference count unless this held a different buffer.
+template <class T>
+void CowData<T>::_move(CowData &p_from) {
+	if (this == &p_from) {
+		return;
+	}
+
+	if (_ptr == p_from._ptr) {
+		// Both share the buffer, p_from just drops its reference.
+		p_from._unref(p_from._ptr);
+		p_from._ptr = nullptr;
+		return;
+	}
+
+	_unref(_ptr);
+	_ptr = p_from._ptr;
+	p_from._ptr = nullptr;
+}
+
 template <class T>
 CowData<T>::~CowData() {
 	_unref(_ptr);
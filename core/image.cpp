@@ -759,6 +759,26 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
+	// The horizontal sampling positions are the same for every row, compute them only once.
+	uint32_t *xofs_left = memnew_arr(uint32_t, p_dst_width);
+	uint32_t *xofs_right = memnew_arr(uint32_t, p_dst_width);
+	uint32_t *xofs_frac = memnew_arr(uint32_t, p_dst_width);
+
+	for (uint32_t j = 0; j < p_dst_width; j++) {
+		uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+		uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+		uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+		if (src_xofs_right >= p_src_width) {
+			src_xofs_right = p_src_width - 1;
+		}
+		uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+		src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+		xofs_left[j] = src_xofs_left * CC;
+		xofs_right[j] = src_xofs_right * CC;
+		xofs_frac[j] = src_xofs_frac;
+	}
+
 	for (uint32_t i = 0; i < p_dst_height; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
@@ -776,17 +796,9 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
 
 		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
-			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
-
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
+			uint32_t src_xofs_left = xofs_left[j];
+			uint32_t src_xofs_right = xofs_right[j];
+			uint32_t src_xofs_frac = xofs_frac[j];
 
 			for (uint32_t l = 0; l < CC; l++) {
 				if (sizeof(T) == 1) { //uint8
@@ -838,6 +850,10 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 			}
 		}
 	}
+
+	memdelete_arr(xofs_left);
+	memdelete_arr(xofs_right);
+	memdelete_arr(xofs_frac);
 }
 
 template <int CC, class T>
@@ -2612,19 +2628,21 @@ void Image::blend_rect(const Ref<Image> &p_src, const Rect2 &p_src_rect, const P
 
 	Ref<Image> img = p_src;
 
-	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = clipped_src_rect.position.x + j;
-			int src_y = clipped_src_rect.position.y + i;
+	// Fetch the data pointers once instead of going through get_pixel/set_pixel,
+	// which check bounds and copy-on-write for every pixel.
+	uint8_t *dst_data_ptr = data.ptrw();
+	const uint8_t *src_data_ptr = img->data.ptr();
 
-			int dst_x = dest_rect.position.x + j;
-			int dst_y = dest_rect.position.y + i;
+	for (int i = 0; i < dest_rect.size.y; i++) {
+		uint32_t src_ofs = (clipped_src_rect.position.y + i) * img->width + clipped_src_rect.position.x;
+		uint32_t dst_ofs = (dest_rect.position.y + i) * width + dest_rect.position.x;
 
-			Color sc = img->get_pixel(src_x, src_y);
+		for (int j = 0; j < dest_rect.size.x; j++) {
+			Color sc = img->_get_color_at_ofs(src_data_ptr, src_ofs + j);
 			if (sc.a != 0) {
-				Color dc = get_pixel(dst_x, dst_y);
+				Color dc = _get_color_at_ofs(dst_data_ptr, dst_ofs + j);
 				dc = dc.blend(sc);
-				set_pixel(dst_x, dst_y, dc);
+				_set_color_at_ofs(dst_data_ptr, dst_ofs + j, dc);
 			}
 		}
 	}
@@ -2662,23 +2680,23 @@ void Image::blend_rect_mask(const Ref<Image> &p_src, const Ref<Image> &p_mask, c
 	Ref<Image> img = p_src;
 	Ref<Image> msk = p_mask;
 
+	uint8_t *dst_data_ptr = data.ptrw();
+	const uint8_t *src_data_ptr = img->data.ptr();
+	const uint8_t *mask_data_ptr = msk->data.ptr();
+
 	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = clipped_src_rect.position.x + j;
-			int src_y = clipped_src_rect.position.y + i;
+		// Mask and source have the same size, so they share the offset.
+		uint32_t src_ofs = (clipped_src_rect.position.y + i) * img->width + clipped_src_rect.position.x;
+		uint32_t dst_ofs = (dest_rect.position.y + i) * width + dest_rect.position.x;
 
+		for (int j = 0; j < dest_rect.size.x; j++) {
 			// If the mask's pixel is transparent then we skip it
-			//Color c = msk->get_pixel(src_x, src_y);
-			//if (c.a == 0) continue;
-			if (msk->get_pixel(src_x, src_y).a != 0) {
-				int dst_x = dest_rect.position.x + j;
-				int dst_y = dest_rect.position.y + i;
-
-				Color sc = img->get_pixel(src_x, src_y);
+			if (msk->_get_color_at_ofs(mask_data_ptr, src_ofs + j).a != 0) {
+				Color sc = img->_get_color_at_ofs(src_data_ptr, src_ofs + j);
 				if (sc.a != 0) {
-					Color dc = get_pixel(dst_x, dst_y);
+					Color dc = _get_color_at_ofs(dst_data_ptr, dst_ofs + j);
 					dc = dc.blend(sc);
-					set_pixel(dst_x, dst_y, dc);
+					_set_color_at_ofs(dst_data_ptr, dst_ofs + j, dc);
 				}
 			}
 		}
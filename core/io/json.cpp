@@ -45,56 +45,57 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-static String _make_indent(const String &p_indent, int p_size) {
-	String indent_text = "";
+static void _append_indent(String &r_out, const String &p_indent, int p_size) {
 	if (!p_indent.empty()) {
 		for (int i = 0; i < p_size; i++) {
-			indent_text += p_indent;
+			r_out += p_indent;
 		}
 	}
-	return indent_text;
 }
 
-String JSON::_print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys) {
-	String colon = ":";
-	String end_statement = "";
-
-	if (!p_indent.empty()) {
-		colon += " ";
-		end_statement += "\n";
-	}
+// Appends to r_out instead of returning a String per value, so nested
+// containers are not copied once for every level they are nested in.
+void JSON::_print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, String &r_out) {
+	const char *colon = p_indent.empty() ? ":" : ": ";
+	const char *end_statement = p_indent.empty() ? "" : "\n";
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_out += "null";
+			break;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_out += p_var.operator bool() ? "true" : "false";
+			break;
 		case Variant::INT:
-			return itos(p_var);
+			r_out += itos(p_var);
+			break;
 		case Variant::FLOAT:
-			return rtos(p_var);
+			r_out += rtos(p_var);
+			break;
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
 		case Variant::PACKED_FLOAT32_ARRAY:
 		case Variant::PACKED_FLOAT64_ARRAY:
 		case Variant::PACKED_STRING_ARRAY:
 		case Variant::ARRAY: {
-			String s = "[";
-			s += end_statement;
+			r_out += "[";
+			r_out += end_statement;
 			Array a = p_var;
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					r_out += ",";
+					r_out += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _print_var(a[i], p_indent, p_cur_indent + 1, p_sort_keys);
+				_append_indent(r_out, p_indent, p_cur_indent + 1);
+				_print_var(a[i], p_indent, p_cur_indent + 1, p_sort_keys, r_out);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
-			return s;
-		}
+			r_out += end_statement;
+			_append_indent(r_out, p_indent, p_cur_indent);
+			r_out += "]";
+		} break;
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
+			r_out += "{";
+			r_out += end_statement;
 			Dictionary d = p_var;
 			List<Variant> keys;
 			d.get_key_list(&keys);
@@ -105,24 +106,30 @@ String JSON::_print_var(const Variant &p_var, const String &p_indent, int p_cur_
 
 			for (List<Variant>::Element *E = keys.front(); E; E = E->next()) {
 				if (E != keys.front()) {
-					s += ",";
-					s += end_statement;
+					r_out += ",";
+					r_out += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _print_var(String(E->get()), p_indent, p_cur_indent + 1, p_sort_keys);
-				s += colon;
-				s += _print_var(d[E->get()], p_indent, p_cur_indent + 1, p_sort_keys);
+				_append_indent(r_out, p_indent, p_cur_indent + 1);
+				_print_var(String(E->get()), p_indent, p_cur_indent + 1, p_sort_keys, r_out);
+				r_out += colon;
+				_print_var(d[E->get()], p_indent, p_cur_indent + 1, p_sort_keys, r_out);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
-			return s;
-		}
+			r_out += end_statement;
+			_append_indent(r_out, p_indent, p_cur_indent);
+			r_out += "}";
+		} break;
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_out += "\"";
+			r_out += String(p_var).json_escape();
+			r_out += "\"";
 	}
 }
 
 String JSON::print(const Variant &p_var, const String &p_indent, bool p_sort_keys) {
-	return _print_var(p_var, p_indent, 0, p_sort_keys);
+	String ret;
+	_print_var(p_var, p_indent, 0, p_sort_keys, ret);
+	return ret;
 }
 
 Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
@@ -170,14 +177,22 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			case '"': {
 				index++;
 				String str;
+				// Plain characters are copied in runs rather than appended one by one.
+				int run_from = index;
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
 						return ERR_PARSE_ERROR;
 					} else if (p_str[index] == '"') {
+						if (index > run_from) {
+							str += String(&p_str[run_from], index - run_from);
+						}
 						index++;
 						break;
 					} else if (p_str[index] == '\\') {
+						if (index > run_from) {
+							str += String(&p_str[run_from], index - run_from);
+						}
 						//escaped characters...
 						index++;
 						char32_t next = p_str[index];
@@ -241,12 +256,10 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						}
 
 						str += res;
+						run_from = index + 1;
 
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+					} else if (p_str[index] == '\n') {
+						line++;
 					}
 					index++;
 				}
@@ -272,15 +285,14 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 					return OK;
 
 				} else if ((p_str[index] >= 'A' && p_str[index] <= 'Z') || (p_str[index] >= 'a' && p_str[index] <= 'z')) {
-					String id;
+					int id_from = index;
 
 					while ((p_str[index] >= 'A' && p_str[index] <= 'Z') || (p_str[index] >= 'a' && p_str[index] <= 'z')) {
-						id += p_str[index];
 						index++;
 					}
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = String(&p_str[id_from], index - id_from);
 					return OK;
 				} else {
 					r_err_str = "Unexpected character.";
@@ -40,6 +40,34 @@ MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
+uint8_t *MessageQueue::_alloc_message(uint32_t p_size) {
+	if (pages_used == 0 || page_bytes[pages_used - 1] + p_size > PAGE_SIZE_BYTES) {
+		if (p_size > PAGE_SIZE_BYTES || pages_used == max_pages) {
+			return nullptr;
+		}
+
+		if (pages_used == pages.size()) {
+			pages.push_back(memnew_arr(uint8_t, PAGE_SIZE_BYTES));
+			page_bytes.push_back(0);
+		}
+
+		page_bytes[pages_used] = 0;
+		pages_used++;
+	}
+
+	uint8_t *ptr = pages[pages_used - 1] + page_bytes[pages_used - 1];
+	page_bytes[pages_used - 1] += p_size;
+	return ptr;
+}
+
+uint32_t MessageQueue::_get_used_bytes() const {
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < pages_used; i++) {
+		used += page_bytes[i];
+	}
+	return used;
+}
+
 Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callable(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
@@ -62,9 +90,9 @@ Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, VARIANT
 Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
 	_THREAD_SAFE_METHOD_
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
+	uint8_t *ptr = _alloc_message(sizeof(Message) + sizeof(Variant));
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	if (!ptr) {
 		String type;
 		if (ObjectDB::get_instance(p_id)) {
 			type = ObjectDB::get_instance(p_id)->get_class();
@@ -74,15 +102,12 @@ Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Vari
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(ptr, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
+	Variant *v = memnew_placement(ptr + sizeof(Message), Variant);
 	*v = p_value;
 
 	return OK;
@@ -93,23 +118,21 @@ Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
 
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
-	uint8_t room_needed = sizeof(Message);
+	uint8_t *ptr = _alloc_message(sizeof(Message));
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	if (!ptr) {
 		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(ptr, Message);
 
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
 
-	buffer_end += sizeof(Message);
-
 	return OK;
 }
 
@@ -128,15 +151,15 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 Error MessageQueue::push_callable(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
 	_THREAD_SAFE_METHOD_
 
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+	uint8_t *ptr = _alloc_message(sizeof(Message) + sizeof(Variant) * p_argcount);
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	if (!ptr) {
 		print_line("Failed method: " + p_callable);
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = memnew_placement(ptr, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -144,11 +167,9 @@ Error MessageQueue::push_callable(const Callable &p_callable, const Variant **p_
 		msg->type |= FLAG_SHOW_ERROR;
 	}
 
-	buffer_end += sizeof(Message);
-
+	Variant *args = (Variant *)(ptr + sizeof(Message));
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
+		Variant *v = memnew_placement(&args[i], Variant);
 		*v = *p_args[i];
 	}
 
@@ -176,9 +197,16 @@ void MessageQueue::statistics() {
 	Map<Callable, int> call_count;
 	int null_count = 0;
 
+	uint32_t read_page = 0;
 	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	while (read_page < pages_used) {
+		if (read_pos >= page_bytes[read_page]) {
+			read_page++;
+			read_pos = 0;
+			continue;
+		}
+
+		Message *message = (Message *)&pages[read_page][read_pos];
 
 		Object *target = message->callable.get_object();
 
@@ -224,7 +252,7 @@ void MessageQueue::statistics() {
 		}
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	print_line("TOTAL BYTES: " + itos(_get_used_bytes()));
 	print_line("NULL count: " + itos(null_count));
 
 	for (Map<StringName, int>::Element *E = set_count.front(); E; E = E->next()) {
@@ -262,10 +290,7 @@ void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_a
 }
 
 void MessageQueue::flush() {
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
-	}
-
+	uint32_t read_page = 0;
 	uint32_t read_pos = 0;
 
 	//using reverse locking strategy
@@ -277,10 +302,18 @@ void MessageQueue::flush() {
 	}
 	flushing = true;
 
-	while (read_pos < buffer_end) {
+	buffer_max_used = MAX(buffer_max_used, _get_used_bytes());
+
+	while (read_page < pages_used) {
 		//lock on each iteration, so a call can re-add itself to the message queue
 
-		Message *message = (Message *)&buffer[read_pos];
+		if (read_pos >= page_bytes[read_page]) {
+			read_page++;
+			read_pos = 0;
+			continue;
+		}
+
+		Message *message = (Message *)&pages[read_page][read_pos];
 
 		uint32_t advance = sizeof(Message);
 		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
@@ -330,7 +363,7 @@ void MessageQueue::flush() {
 		_THREAD_SAFE_LOCK_
 	}
 
-	buffer_end = 0; // reset buffer
+	pages_used = 0; // reset buffer, pages are kept for reuse
 	flushing = false;
 	_THREAD_SAFE_UNLOCK_
 }
@@ -343,17 +376,23 @@ MessageQueue::MessageQueue() {
 	ERR_FAIL_COND_MSG(singleton != nullptr, "A MessageQueue singleton already exists.");
 	singleton = this;
 
-	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
+	uint32_t max_size_kb = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
-	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+	max_pages = MAX(1u, max_size_kb * 1024 / PAGE_SIZE_BYTES);
 }
 
 MessageQueue::~MessageQueue() {
+	uint32_t read_page = 0;
 	uint32_t read_pos = 0;
 
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	while (read_page < pages_used) {
+		if (read_pos >= page_bytes[read_page]) {
+			read_page++;
+			read_pos = 0;
+			continue;
+		}
+
+		Message *message = (Message *)&pages[read_page][read_pos];
 		Variant *args = (Variant *)(message + 1);
 		int argc = message->args;
 		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
@@ -370,5 +409,8 @@ MessageQueue::~MessageQueue() {
 	}
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
+
+	for (uint32_t i = 0; i < pages.size(); i++) {
+		memdelete_arr(pages[i]);
+	}
 }
@@ -31,6 +31,7 @@
 #ifndef MESSAGE_QUEUE_H
 #define MESSAGE_QUEUE_H
 
+#include "core/local_vector.h"
 #include "core/object.h"
 #include "core/os/thread_safe.h"
 
@@ -39,7 +40,8 @@ class MessageQueue {
 
 	enum {
 
-		DEFAULT_QUEUE_SIZE_KB = 1024
+		DEFAULT_QUEUE_SIZE_KB = 1024,
+		PAGE_SIZE_BYTES = 64 * 1024
 	};
 
 	enum {
@@ -60,10 +62,16 @@ class MessageQueue {
 		};
 	};
 
-	uint8_t *buffer;
-	uint32_t buffer_end = 0;
+	// Pages are allocated as the queue grows and kept for reuse after a flush.
+	// Messages never span two pages.
+	LocalVector<uint8_t *> pages;
+	LocalVector<uint32_t> page_bytes;
+	uint32_t pages_used = 0;
+	uint32_t max_pages;
 	uint32_t buffer_max_used = 0;
-	uint32_t buffer_size;
+
+	uint8_t *_alloc_message(uint32_t p_size);
+	uint32_t _get_used_bytes() const;
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
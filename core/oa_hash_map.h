@@ -44,7 +44,12 @@
  * improve the performance and to avoid infinite loops in rare cases.
  *
  * The entries are stored inplace, so huge keys or values might fill cache lines
- * a lot faster.
+ * a lot faster. The hashes are kept in their own array, so probing only touches
+ * the keys of entries whose hash matches.
+ *
+ * The capacity is always a power of two, which lets positions be computed with
+ * a mask instead of a modulo. It's never smaller than 8, so the 7/8 load limit
+ * always leaves at least one free position to end probing.
  *
  * Only used keys and values are constructed. For free positions there's space
  * in the arrays for each, but that memory is kept uninitialized.
@@ -65,6 +70,7 @@ private:
 	uint32_t num_elements = 0;
 
 	static const uint32_t EMPTY_HASH = 0;
+	static const uint32_t MIN_CAPACITY = 8;
 
 	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
 		uint32_t hash = Hasher::hash(p_key);
@@ -77,8 +83,13 @@ private:
 	}
 
 	_FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash) const {
-		uint32_t original_pos = p_hash % capacity;
-		return (p_pos - original_pos + capacity) % capacity;
+		uint32_t original_pos = p_hash & (capacity - 1);
+		return (p_pos - original_pos) & (capacity - 1);
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_capacity_for(uint32_t p_capacity) {
+		// Capacity must be a power of two, and at least 8 so the load limit keeps a position free.
+		return next_power_of_2(MAX(MIN_CAPACITY, p_capacity));
 	}
 
 	_FORCE_INLINE_ void _construct(uint32_t p_pos, uint32_t p_hash, const TKey &p_key, const TValue &p_value) {
@@ -91,7 +102,7 @@ private:
 
 	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
 		uint32_t hash = _hash(p_key);
-		uint32_t pos = hash % capacity;
+		uint32_t pos = hash & (capacity - 1);
 		uint32_t distance = 0;
 
 		while (true) {
@@ -108,16 +119,33 @@ private:
 				return true;
 			}
 
-			pos = (pos + 1) % capacity;
+			pos = (pos + 1) & (capacity - 1);
 			distance++;
 		}
 	}
 
 	void _insert_with_hash(uint32_t p_hash, const TKey &p_key, const TValue &p_value) {
-		uint32_t hash = p_hash;
 		uint32_t distance = 0;
-		uint32_t pos = hash % capacity;
+		uint32_t pos = p_hash & (capacity - 1);
 
+		// Find the first slot that is either free or owned by an entry closer to
+		// its home position. Only in the latter case do we need temporaries.
+		while (hashes[pos] != EMPTY_HASH) {
+			uint32_t existing_probe_len = _get_probe_length(pos, hashes[pos]);
+			if (existing_probe_len < distance) {
+				break;
+			}
+
+			pos = (pos + 1) & (capacity - 1);
+			distance++;
+		}
+
+		if (hashes[pos] == EMPTY_HASH) {
+			_construct(pos, p_hash, p_key, p_value);
+			return;
+		}
+
+		uint32_t hash = p_hash;
 		TKey key = p_key;
 		TValue value = p_value;
 
@@ -137,7 +165,7 @@ private:
 				distance = existing_probe_len;
 			}
 
-			pos = (pos + 1) % capacity;
+			pos = (pos + 1) & (capacity - 1);
 			distance++;
 		}
 	}
@@ -145,8 +173,7 @@ private:
 	void _resize_and_rehash(uint32_t p_new_capacity) {
 		uint32_t old_capacity = capacity;
 
-		// Capacity can't be 0.
-		capacity = MAX(1, p_new_capacity);
+		capacity = _get_capacity_for(p_new_capacity);
 
 		TKey *old_keys = keys;
 		TValue *old_values = values;
@@ -209,7 +236,8 @@ public:
 	}
 
 	void insert(const TKey &p_key, const TValue &p_value) {
-		if (num_elements + 1 > 0.9 * capacity) {
+		// Keep the load factor at or below 7/8.
+		if (num_elements + 1 > capacity - (capacity >> 3)) {
 			_resize_and_rehash();
 		}
 
@@ -276,14 +304,14 @@ public:
 			return;
 		}
 
-		uint32_t next_pos = (pos + 1) % capacity;
+		uint32_t next_pos = (pos + 1) & (capacity - 1);
 		while (hashes[next_pos] != EMPTY_HASH &&
 				_get_probe_length(next_pos, hashes[next_pos]) != 0) {
 			SWAP(hashes[next_pos], hashes[pos]);
 			SWAP(keys[next_pos], keys[pos]);
 			SWAP(values[next_pos], values[pos]);
 			pos = next_pos;
-			next_pos = (pos + 1) % capacity;
+			next_pos = (pos + 1) & (capacity - 1);
 		}
 
 		hashes[pos] = EMPTY_HASH;
@@ -296,9 +324,12 @@ public:
 	/**
 	 * reserves space for a number of elements, useful to avoid many resizes and rehashes
 	 *  if adding a known (possibly large) number of elements at once, must be larger than old
-	 *  capacity.
+	 *  capacity. The capacity is rounded up to the next power of two.
 	 **/
 	void reserve(uint32_t p_new_capacity) {
+		if (_get_capacity_for(p_new_capacity) == capacity) {
+			return;
+		}
 		ERR_FAIL_COND(p_new_capacity < capacity);
 		_resize_and_rehash(p_new_capacity);
 	}
@@ -368,8 +399,7 @@ public:
 	}
 
 	OAHashMap(uint32_t p_initial_capacity = 64) {
-		// Capacity can't be 0.
-		capacity = MAX(1, p_initial_capacity);
+		capacity = _get_capacity_for(p_initial_capacity);
 
 		keys = static_cast<TKey *>(Memory::alloc_static(sizeof(TKey) * capacity));
 		values = static_cast<TValue *>(Memory::alloc_static(sizeof(TValue) * capacity));
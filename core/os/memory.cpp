@@ -64,8 +64,6 @@ uint64_t Memory::mem_usage = 0;
 uint64_t Memory::max_usage = 0;
 #endif
 
-uint64_t Memory::alloc_count = 0;
-
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 	bool prepad = true;
@@ -77,8 +75,6 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	ERR_FAIL_COND_V(!mem, nullptr);
 
-	atomic_increment(&alloc_count);
-
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
 		*s = p_bytes;
@@ -86,8 +82,8 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 #ifdef DEBUG_ENABLED
-		atomic_add(&mem_usage, p_bytes);
-		atomic_exchange_if_greater(&max_usage, mem_usage);
+		uint64_t new_usage = atomic_add(&mem_usage, p_bytes);
+		atomic_exchange_if_greater(&max_usage, new_usage);
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -114,8 +110,8 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		if (p_bytes > *s) {
-			atomic_add(&mem_usage, p_bytes - *s);
-			atomic_exchange_if_greater(&max_usage, mem_usage);
+			uint64_t new_usage = atomic_add(&mem_usage, p_bytes - *s);
+			atomic_exchange_if_greater(&max_usage, new_usage);
 		} else {
 			atomic_sub(&mem_usage, *s - p_bytes);
 		}
@@ -156,8 +152,6 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	atomic_decrement(&alloc_count);
-
 	if (prepad) {
 		mem -= PAD_ALIGN;
 
@@ -47,8 +47,6 @@ class Memory {
 	static uint64_t max_usage;
 #endif
 
-	static uint64_t alloc_count;
-
 public:
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
@@ -53,7 +53,7 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 
 	if (path_cache != "") {
 		ResourceCache::lock->write_lock();
-		ResourceCache::resources.erase(path_cache);
+		ResourceCache::resources.remove(path_cache);
 		ResourceCache::lock->write_unlock();
 	}
 
@@ -66,7 +66,7 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 	if (has_path) {
 		if (p_take_over) {
 			ResourceCache::lock->write_lock();
-			Resource **res = ResourceCache::resources.getptr(p_path);
+			Resource **res = ResourceCache::resources.lookup_ptr(p_path);
 			if (res) {
 				(*res)->set_name("");
 			}
@@ -83,7 +83,7 @@ void Resource::set_path(const String &p_path, bool p_take_over) {
 
 	if (path_cache != "") {
 		ResourceCache::lock->write_lock();
-		ResourceCache::resources[path_cache] = this;
+		ResourceCache::resources.set(path_cache, this);
 		ResourceCache::lock->write_unlock();
 	}
 
@@ -405,7 +405,7 @@ Resource::Resource() :
 Resource::~Resource() {
 	if (path_cache != "") {
 		ResourceCache::lock->write_lock();
-		ResourceCache::resources.erase(path_cache);
+		ResourceCache::resources.remove(path_cache);
 		ResourceCache::lock->write_unlock();
 	}
 	if (owners.size()) {
@@ -413,7 +413,7 @@ Resource::~Resource() {
 	}
 }
 
-HashMap<String, Resource *> ResourceCache::resources;
+OAHashMap<String, Resource *> ResourceCache::resources;
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, int>> ResourceCache::resource_path_cache;
 #endif
@@ -431,13 +431,12 @@ void ResourceCache::setup() {
 }
 
 void ResourceCache::clear() {
-	if (resources.size()) {
+	if (!resources.empty()) {
 		ERR_PRINT("Resources still in use at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
-			const String *K = nullptr;
-			while ((K = resources.next(K))) {
-				Resource *r = resources[*K];
-				print_line(vformat("Resource still in use: %s (%s)", *K, r->get_class()));
+			for (OAHashMap<String, Resource *>::Iterator it = resources.iter(); it.valid; it = resources.next_iter(it)) {
+				Resource *r = *it.value;
+				print_line(vformat("Resource still in use: %s (%s)", *it.key, r->get_class()));
 			}
 		}
 	}
@@ -463,30 +462,25 @@ bool ResourceCache::has(const String &p_path) {
 Resource *ResourceCache::get(const String &p_path) {
 	lock->read_lock();
 
-	Resource **res = resources.getptr(p_path);
+	Resource *res = nullptr;
+	resources.lookup(p_path, res);
 
 	lock->read_unlock();
 
-	if (!res) {
-		return nullptr;
-	}
-
-	return *res;
+	return res;
 }
 
 void ResourceCache::get_cached_resources(List<Ref<Resource>> *p_resources) {
 	lock->read_lock();
-	const String *K = nullptr;
-	while ((K = resources.next(K))) {
-		Resource *r = resources[*K];
-		p_resources->push_back(Ref<Resource>(r));
+	for (OAHashMap<String, Resource *>::Iterator it = resources.iter(); it.valid; it = resources.next_iter(it)) {
+		p_resources->push_back(Ref<Resource>(*it.value));
 	}
 	lock->read_unlock();
 }
 
 int ResourceCache::get_cached_resource_count() {
 	lock->read_lock();
-	int rc = resources.size();
+	int rc = resources.get_num_elements();
 	lock->read_unlock();
 
 	return rc;
@@ -504,9 +498,8 @@ void ResourceCache::dump(const char *p_file, bool p_short) {
 		ERR_FAIL_COND_MSG(!f, "Cannot create file at path '" + String(p_file) + "'.");
 	}
 
-	const String *K = nullptr;
-	while ((K = resources.next(K))) {
-		Resource *r = resources[*K];
+	for (OAHashMap<String, Resource *>::Iterator it = resources.iter(); it.valid; it = resources.next_iter(it)) {
+		Resource *r = *it.value;
 
 		if (!type_count.has(r->get_class())) {
 			type_count[r->get_class()] = 0;
@@ -59,11 +59,11 @@ public:
 		int pos = read_pos;
 		int to_read = p_size;
 		int dst = 0;
+		const T *read = data.ptr();
 		while (to_read) {
 			int end = pos + to_read;
 			end = MIN(end, size());
 			int total = end - pos;
-			const T *read = data.ptr();
 			for (int i = 0; i < total; i++) {
 				p_buf[dst++] = read[pos + i];
 			}
@@ -89,12 +89,13 @@ public:
 		inc(pos, p_offset);
 		int to_read = p_size;
 		int dst = 0;
+		const T *read = data.ptr();
 		while (to_read) {
 			int end = pos + to_read;
 			end = MIN(end, size());
 			int total = end - pos;
 			for (int i = 0; i < total; i++) {
-				p_buf[dst++] = data[pos + i];
+				p_buf[dst++] = read[pos + i];
 			}
 			to_read -= total;
 			pos = 0;
@@ -129,6 +130,16 @@ public:
 		return -1;
 	}
 
+	// Returns a pointer to the next `p_size` elements when they are stored contiguously
+	// (i.e. they do not wrap around the end of the buffer), or nullptr otherwise.
+	// The pointer stays valid until the read position is advanced past those elements.
+	const T *get_contiguous_read_ptr(int p_size) const {
+		if (p_size <= 0 || p_size > data_left() || read_pos + p_size > size()) {
+			return nullptr;
+		}
+		return data.ptr() + read_pos;
+	}
+
 	inline int advance_read(int p_n) {
 		p_n = MIN(p_n, data_left());
 		inc(read_pos, p_n);
@@ -154,13 +165,15 @@ public:
 		int pos = write_pos;
 		int to_write = p_size;
 		int src = 0;
+		// Fetch the write pointer once, indexing `data.write` would check for copy-on-write on every element.
+		T *write = data.ptrw();
 		while (to_write) {
 			int end = pos + to_write;
 			end = MIN(end, size());
 			int total = end - pos;
 
 			for (int i = 0; i < total; i++) {
-				data.write[pos + i] = p_buf[src++];
+				write[pos + i] = p_buf[src++];
 			}
 			to_write -= total;
 			pos = 0;
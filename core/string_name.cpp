@@ -46,7 +46,7 @@ StringName _scs_create(const char *p_chr) {
 }
 
 bool StringName::configured = false;
-Mutex StringName::mutex;
+Mutex StringName::mutex[STRING_TABLE_MUTEX_LEN];
 
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
@@ -57,10 +57,9 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(mutex);
-
 	int lost_strings = 0;
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
+		MutexLock lock(_get_mutex(i));
 		while (_table[i]) {
 			_Data *d = _table[i];
 			lost_strings++;
@@ -85,7 +84,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(_get_mutex(_data->idx));
 
 		if (_data->prev) {
 			_data->prev->next = _data->next;
@@ -105,12 +104,34 @@ void StringName::unref() {
 	_data = nullptr;
 }
 
+bool StringName::_Data::operator==(const String &p_name) const {
+	return cname ? p_name == cname : name == p_name;
+}
+
+bool StringName::_Data::operator==(const char *p_name) const {
+	return cname ? strcmp(cname, p_name) == 0 : name == p_name;
+}
+
+bool StringName::_Data::operator==(const char32_t *p_name) const {
+	if (!cname) {
+		return name == p_name;
+	}
+	const char *c = cname;
+	// Convert each char the same way String::copy_from(const char *) does, so the result
+	// matches comparing against the String built from cname, even for non-ASCII bytes.
+	while (*c && (char32_t)*c == *p_name) {
+		c++;
+		p_name++;
+	}
+	return *c == 0 && *p_name == 0;
+}
+
 bool StringName::operator==(const String &p_name) const {
 	if (!_data) {
 		return (p_name.length() == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	return (*_data == p_name);
 }
 
 bool StringName::operator==(const char *p_name) const {
@@ -118,7 +139,7 @@ bool StringName::operator==(const char *p_name) const {
 		return (p_name[0] == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	return (*_data == p_name);
 }
 
 bool StringName::operator!=(const String &p_name) const {
@@ -162,17 +183,16 @@ StringName::StringName(const char *p_name) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && *_data == p_name) {
 			break;
 		}
 		_data = _data->next;
@@ -199,24 +219,27 @@ StringName::StringName(const char *p_name) {
 	_table[idx] = _data;
 }
 
-StringName::StringName(const StaticCString &p_static_string) {
+StringName::StringName(const StaticCString &p_static_string) :
+		StringName(p_static_string, p_static_string.ptr ? String::hash(p_static_string.ptr) : 0) {
+}
+
+StringName::StringName(const StaticCString &p_static_string, uint32_t p_hash) {
 	_data = nullptr;
 
 	ERR_FAIL_COND(!configured);
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_static_string.ptr);
-
+	uint32_t hash = p_hash;
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
+		if (_data->hash == hash && *_data == p_static_string.ptr) {
 			break;
 		}
 		_data = _data->next;
@@ -252,15 +275,15 @@ StringName::StringName(const String &p_name) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && *_data == p_name) {
 			break;
 		}
 		_data = _data->next;
@@ -295,16 +318,16 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && *_data == p_name) {
 			break;
 		}
 		_data = _data->next;
@@ -325,17 +348,16 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
+		if (_data->hash == hash && *_data == p_name) {
 			break;
 		}
 		_data = _data->next;
@@ -351,17 +373,16 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name == "", StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && p_name == _data->get_name()) {
+		if (_data->hash == hash && *_data == p_name) {
 			break;
 		}
 		_data = _data->next;
@@ -35,6 +35,8 @@
 #include "core/safe_refcount.h"
 #include "core/ustring.h"
 
+#include <type_traits>
+
 class Main;
 
 struct StaticCString {
@@ -47,7 +49,13 @@ class StringName {
 
 		STRING_TABLE_BITS = 12,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+
+		// The table is split in shards, each guarded by its own mutex, so threads
+		// creating or releasing unrelated names don't contend on a single lock.
+		STRING_TABLE_MUTEX_BITS = 6,
+		STRING_TABLE_MUTEX_LEN = 1 << STRING_TABLE_MUTEX_BITS,
+		STRING_TABLE_MUTEX_MASK = STRING_TABLE_MUTEX_LEN - 1
 	};
 
 	struct _Data {
@@ -56,6 +64,10 @@ class StringName {
 		String name;
 
 		String get_name() const { return cname ? String(cname) : name; }
+		// Compare without building a temporary String for static names.
+		bool operator==(const String &p_name) const;
+		bool operator==(const char *p_name) const;
+		bool operator==(const char32_t *p_name) const;
 		int idx = 0;
 		uint32_t hash = 0;
 		_Data *prev = nullptr;
@@ -76,7 +88,8 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
-	static Mutex mutex;
+	static Mutex mutex[STRING_TABLE_MUTEX_LEN];
+	static _FORCE_INLINE_ Mutex &_get_mutex(uint32_t p_idx) { return mutex[p_idx & STRING_TABLE_MUTEX_MASK]; }
 	static void setup();
 	static void cleanup();
 	static bool configured;
@@ -121,6 +134,15 @@ public:
 		return String();
 	}
 
+	// Same as String::hash(const char *), but usable in constant expressions.
+	static constexpr uint32_t hash_static(const char *p_name) {
+		uint32_t hash = 5381;
+		while (*p_name) {
+			hash = ((hash << 5) + hash) + uint32_t(*p_name++); /* hash * 33 + c */
+		}
+		return hash;
+	}
+
 	static StringName search(const char *p_name);
 	static StringName search(const char32_t *p_name);
 	static StringName search(const String &p_name);
@@ -151,10 +173,15 @@ public:
 	StringName(const StringName &p_name);
 	StringName(const String &p_name);
 	StringName(const StaticCString &p_static_string);
+	// p_hash must be hash_static() of the string, see STATIC_SNAME.
+	StringName(const StaticCString &p_static_string, uint32_t p_hash);
 	StringName() {}
 	~StringName();
 };
 
 StringName _scs_create(const char *p_chr);
 
+// Static name from a string literal, hashed at compile time rather than on creation.
+#define STATIC_SNAME(m_name) StringName(StaticCString::create(m_name), std::integral_constant<uint32_t, StringName::hash_static(m_name)>::value)
+
 #endif // STRING_NAME_H
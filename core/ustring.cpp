@@ -1739,6 +1739,14 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 	char32_t *dst = ptrw();
 	dst[str_size] = 0;
 
+	if (str_size == cstr_size) {
+		// Every byte is a complete character, so the input is plain ASCII.
+		for (int i = 0; i < str_size; i++) {
+			dst[i] = uint8_t(p_utf8[i]);
+		}
+		return false;
+	}
+
 	while (cstr_size) {
 		int len = 0;
 
@@ -1837,6 +1845,15 @@ CharString String::utf8() const {
 	utf8s.resize(fl + 1);
 	uint8_t *cdst = (uint8_t *)utf8s.get_data();
 
+	if (fl == l) {
+		// Only 7-bit characters, copy them straight.
+		for (int i = 0; i < l; i++) {
+			cdst[i] = uint8_t(d[i]);
+		}
+		cdst[l] = 0;
+		return utf8s;
+	}
+
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
@@ -2762,24 +2779,20 @@ int String::find(const String &p_str, int p_from) const {
 
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
+	const char32_t first = str[0];
 
 	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
+		// Scan for the first character before comparing the rest.
+		if (src[i] != first) {
+			continue;
+		}
 
-			if (src[read_pos] != str[j]) {
-				found = false;
-				break;
-			}
+		int j = 1;
+		while (j < src_len && src[i + j] == str[j]) {
+			j++;
 		}
 
-		if (found) {
+		if (j == src_len) {
 			return i;
 		}
 	}
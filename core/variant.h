@@ -47,6 +47,7 @@
 #include "core/math/vector3i.h"
 #include "core/node_path.h"
 #include "core/object_id.h"
+#include "core/paged_allocator.h"
 #include "core/rid.h"
 #include "core/ustring.h"
 
@@ -190,6 +191,27 @@ private:
 	};
 
 	/* end of array helpers */
+
+	// Math types too large to fit in _data are allocated from these pools
+	// instead of going through memnew/memdelete for every copy.
+	struct Pools {
+		union BucketSmall {
+			BucketSmall() {}
+			~BucketSmall() {}
+			Transform2D _transform2d;
+			::AABB _aabb;
+		};
+		union BucketLarge {
+			BucketLarge() {}
+			~BucketLarge() {}
+			Basis _basis;
+			Transform _transform;
+		};
+
+		static PagedAllocator<BucketSmall, true> _bucket_small;
+		static PagedAllocator<BucketLarge, true> _bucket_large;
+	};
+
 	_ALWAYS_INLINE_ ObjData &_get_obj();
 	_ALWAYS_INLINE_ const ObjData &_get_obj() const;
 
@@ -33,10 +33,24 @@
 #include "core/input/input_event.h"
 #include "core/io/resource_loader.h"
 #include "core/os/keyboard.h"
-#include "core/string_buffer.h"
 
 char32_t VariantParser::StreamFile::get_char() {
-	return f->get_8();
+	if (readahead_pointer == readahead_filled) {
+		if (eof) {
+			return 0;
+		}
+
+		readahead_filled = f->get_buffer(readahead_buffer, READAHEAD_SIZE);
+		readahead_pointer = 0;
+
+		if (readahead_filled == 0) {
+			// Like FileAccess, EOF is only reported once a read past the end was attempted.
+			eof = true;
+			return 0;
+		}
+	}
+
+	return readahead_buffer[readahead_pointer++];
 }
 
 bool VariantParser::StreamFile::is_utf8() const {
@@ -44,7 +58,13 @@ bool VariantParser::StreamFile::is_utf8() const {
 }
 
 bool VariantParser::StreamFile::is_eof() const {
-	return f->eof_reached();
+	return eof;
+}
+
+uint64_t VariantParser::StreamFile::get_position() const {
+	// A character put back in saved was already read from the buffer. Characters are
+	// returned as single bytes, so it takes one.
+	return f->get_position() - (readahead_filled - readahead_pointer) - (saved ? 1 : 0);
 }
 
 char32_t VariantParser::StreamString::get_char() {
@@ -90,6 +110,73 @@ const char *VariantParser::tk_name[TK_MAX] = {
 	"ERROR"
 };
 
+// Reads a number starting with p_char, the character following it is put back in p_stream->saved.
+void VariantParser::_read_number(Stream *p_stream, char32_t p_char, StringBuffer<> &r_num, bool &r_is_float) {
+#define READING_SIGN 0
+#define READING_INT 1
+#define READING_DEC 2
+#define READING_EXP 3
+#define READING_DONE 4
+	int reading = READING_INT;
+
+	if (p_char == '-') {
+		r_num += '-';
+		p_char = p_stream->get_char();
+	}
+
+	char32_t c = p_char;
+	bool exp_sign = false;
+	bool exp_beg = false;
+	r_is_float = false;
+
+	while (true) {
+		switch (reading) {
+			case READING_INT: {
+				if (c >= '0' && c <= '9') {
+					//pass
+				} else if (c == '.') {
+					reading = READING_DEC;
+					r_is_float = true;
+				} else if (c == 'e') {
+					reading = READING_EXP;
+					r_is_float = true;
+				} else {
+					reading = READING_DONE;
+				}
+
+			} break;
+			case READING_DEC: {
+				if (c >= '0' && c <= '9') {
+				} else if (c == 'e') {
+					reading = READING_EXP;
+				} else {
+					reading = READING_DONE;
+				}
+
+			} break;
+			case READING_EXP: {
+				if (c >= '0' && c <= '9') {
+					exp_beg = true;
+
+				} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
+					exp_sign = true;
+
+				} else {
+					reading = READING_DONE;
+				}
+			} break;
+		}
+
+		if (reading == READING_DONE) {
+			break;
+		}
+		r_num += c;
+		c = p_stream->get_char();
+	}
+
+	p_stream->saved = c;
+}
+
 Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, String &r_err_str) {
 	bool string_name = false;
 
@@ -309,69 +396,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					//a number
 
 					StringBuffer<> num;
-#define READING_SIGN 0
-#define READING_INT 1
-#define READING_DEC 2
-#define READING_EXP 3
-#define READING_DONE 4
-					int reading = READING_INT;
-
-					if (cchar == '-') {
-						num += '-';
-						cchar = p_stream->get_char();
-					}
-
-					char32_t c = cchar;
-					bool exp_sign = false;
-					bool exp_beg = false;
 					bool is_float = false;
-
-					while (true) {
-						switch (reading) {
-							case READING_INT: {
-								if (c >= '0' && c <= '9') {
-									//pass
-								} else if (c == '.') {
-									reading = READING_DEC;
-									is_float = true;
-								} else if (c == 'e') {
-									reading = READING_EXP;
-									is_float = true;
-								} else {
-									reading = READING_DONE;
-								}
-
-							} break;
-							case READING_DEC: {
-								if (c >= '0' && c <= '9') {
-								} else if (c == 'e') {
-									reading = READING_EXP;
-								} else {
-									reading = READING_DONE;
-								}
-
-							} break;
-							case READING_EXP: {
-								if (c >= '0' && c <= '9') {
-									exp_beg = true;
-
-								} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
-									exp_sign = true;
-
-								} else {
-									reading = READING_DONE;
-								}
-							} break;
-						}
-
-						if (reading == READING_DONE) {
-							break;
-						}
-						num += c;
-						c = p_stream->get_char();
-					}
-
-					p_stream->saved = c;
+					_read_number(p_stream, cchar, num, is_float);
 
 					r_token.type = TK_NUMBER;
 
@@ -440,8 +466,10 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
-template <class T>
+template <class T, class C>
 Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
+	const int components = sizeof(T) / sizeof(C);
+
 	Token token;
 	get_token(p_stream, token, line, r_err_str);
 	if (token.type != TK_PARENTHESIS_OPEN) {
@@ -449,6 +477,12 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Numbers are written straight into the array, which grows in steps and is trimmed at the end.
+	r_construct.resize(0);
+	C *w = nullptr;
+	int count = 0;
+	int capacity = 0;
+
 	bool first = true;
 	while (true) {
 		if (!first) {
@@ -462,19 +496,53 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 				return ERR_PARSE_ERROR;
 			}
 		}
-		get_token(p_stream, token, line, r_err_str);
 
-		if (first && token.type == TK_PARENTHESIS_CLOSE) {
-			break;
-		} else if (token.type != TK_NUMBER) {
-			r_err_str = "Expected float in constructor";
-			return ERR_PARSE_ERROR;
+		char32_t c;
+		do {
+			if (p_stream->saved) {
+				c = p_stream->saved;
+				p_stream->saved = 0;
+			} else {
+				c = p_stream->get_char();
+			}
+			if (c == '\n') {
+				line++;
+			}
+		} while (c > 0 && c <= 32 && !p_stream->is_eof());
+
+		C value;
+		if (c == '-' || (c >= '0' && c <= '9')) {
+			// Read numbers here rather than through a token, to avoid going through a Variant.
+			StringBuffer<> num;
+			bool is_float = false;
+			_read_number(p_stream, c, num, is_float);
+			value = is_float ? C(num.as_double()) : C(num.as_int());
+		} else {
+			p_stream->saved = c;
+			get_token(p_stream, token, line, r_err_str);
+
+			if (first && token.type == TK_PARENTHESIS_CLOSE) {
+				break;
+			} else if (token.type != TK_NUMBER) {
+				r_err_str = "Expected float in constructor";
+				return ERR_PARSE_ERROR;
+			}
+			value = token.value;
 		}
 
-		r_construct.push_back(token.value);
+		if (count == capacity) {
+			int size = MAX(4, r_construct.size() * 2);
+			r_construct.resize(size);
+			w = reinterpret_cast<C *>(r_construct.ptrw());
+			capacity = size * components;
+		}
+		w[count++] = value;
 		first = false;
 	}
 
+	// An incomplete trailing element is dropped.
+	r_construct.resize(count / components);
+
 	return OK;
 }
 
@@ -879,17 +947,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -897,17 +955,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -915,17 +963,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -933,17 +971,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -951,17 +979,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
@@ -1009,58 +1027,28 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = arr;
 		} else if (id == "PackedVector2Array" || id == "PoolVector2Array" || id == "Vector2Array") {
-			Vector<float> args;
-			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
+			Vector<Vector2> arr;
+			Error err = _parse_construct<Vector2, real_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<Vector2> arr;
-			{
-				int len = args.size() / 2;
-				arr.resize(len);
-				Vector2 *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = Vector2(args[i * 2 + 0], args[i * 2 + 1]);
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedVector3Array" || id == "PoolVector3Array" || id == "Vector3Array") {
-			Vector<float> args;
-			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
+			Vector<Vector3> arr;
+			Error err = _parse_construct<Vector3, real_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<Vector3> arr;
-			{
-				int len = args.size() / 3;
-				arr.resize(len);
-				Vector3 *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = Vector3(args[i * 3 + 0], args[i * 3 + 1], args[i * 3 + 2]);
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedColorArray" || id == "PoolColorArray" || id == "ColorArray") {
-			Vector<float> args;
-			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
+			Vector<Color> arr;
+			Error err = _parse_construct<Color, float>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<Color> arr;
-			{
-				int len = args.size() / 4;
-				arr.resize(len);
-				Color *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = Color(args[i * 4 + 0], args[i * 4 + 1], args[i * 4 + 2], args[i * 4 + 3]);
-				}
-			}
-
 			value = arr;
 		} else {
 			r_err_str = "Unexpected identifier: '" + id + "'.";
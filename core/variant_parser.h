@@ -33,6 +33,7 @@
 
 #include "core/os/file_access.h"
 #include "core/resource.h"
+#include "core/string_buffer.h"
 #include "core/variant.h"
 
 class VariantParser {
@@ -49,12 +50,27 @@ public:
 	};
 
 	struct StreamFile : public Stream {
+	private:
+		enum {
+			READAHEAD_SIZE = 2048
+		};
+
+		// Reading the file in blocks avoids a virtual FileAccess call per character.
+		uint8_t readahead_buffer[READAHEAD_SIZE];
+		uint32_t readahead_pointer = 0;
+		uint32_t readahead_filled = 0;
+		bool eof = false;
+
+	public:
 		FileAccess *f = nullptr;
 
 		virtual char32_t get_char();
 		virtual bool is_utf8() const;
 		virtual bool is_eof() const;
 
+		// Position in the file of the next character to be read, as the file's own position is ahead of it.
+		uint64_t get_position() const;
+
 		StreamFile() {}
 	};
 
@@ -120,7 +136,9 @@ public:
 private:
 	static const char *tk_name[TK_MAX];
 
-	template <class T>
+	static void _read_number(Stream *p_stream, char32_t p_char, StringBuffer<> &r_num, bool &r_is_float);
+	// T is the element type, made of components of type C (e.g. Vector3 and real_t).
+	template <class T, class C = T>
 	static Error _parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str);
 	static Error _parse_enginecfg(Stream *p_stream, Vector<String> &strings, int &line, String &r_err_str);
 	static Error _parse_dictionary(Dictionary &object, Stream *p_stream, int &line, String &r_err_str, ResourceParser *p_res_parser = nullptr);
@@ -127,6 +127,11 @@ public:
 		return *this;
 	}
 
+	inline Vector &operator=(Vector &&p_from) {
+		_cowdata._move(p_from._cowdata);
+		return *this;
+	}
+
 	Vector<uint8_t> to_byte_array() const {
 		Vector<uint8_t> ret;
 		ret.resize(size() * sizeof(T));
@@ -159,6 +164,7 @@ public:
 
 	_FORCE_INLINE_ Vector() {}
 	_FORCE_INLINE_ Vector(const Vector &p_from) { _cowdata._ref(p_from._cowdata); }
+	_FORCE_INLINE_ Vector(Vector &&p_from) { _cowdata._move(p_from._cowdata); }
 
 	_FORCE_INLINE_ ~Vector() {}
 };
@@ -44,6 +44,8 @@ private:
 
 	RingBuffer<_Packet> _packets;
 	RingBuffer<uint8_t> _payload;
+	// Payload bytes handed out by `read_packet_ptr` that are still owned by the caller.
+	int _pending_release = 0;
 
 public:
 	Error write_packet(const uint8_t *p_payload, uint32_t p_size, const T *p_info) {
@@ -79,6 +81,7 @@ public:
 	}
 
 	Error read_packet(uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
+		release_packet();
 		ERR_FAIL_COND_V(_packets.data_left() < 1, ERR_UNAVAILABLE);
 		_Packet p;
 		_packets.read(&p, 1);
@@ -91,11 +94,45 @@ public:
 		return OK;
 	}
 
+	// Reads the next packet without copying its payload when it is stored contiguously.
+	// On success `r_payload` points inside the buffer and stays valid until the next call to
+	// `release_packet`, `read_packet`, `read_packet_ptr`, `resize` or `clear`.
+	// Returns ERR_BUSY (without consuming anything) when the payload wraps around
+	// the end of the buffer, in which case `read_packet` must be used instead.
+	Error read_packet_ptr(const uint8_t **r_payload, T *r_info, int &r_read) {
+		release_packet();
+		ERR_FAIL_COND_V(_packets.data_left() < 1, ERR_UNAVAILABLE);
+		_Packet p;
+		_packets.copy(&p, 0, 1);
+		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
+
+		const uint8_t *ptr = _payload.get_contiguous_read_ptr(p.size);
+		if (!ptr && p.size > 0) {
+			return ERR_BUSY;
+		}
+		_packets.advance_read(1);
+
+		r_read = p.size;
+		copymem(r_info, &p.info, sizeof(T));
+		*r_payload = ptr;
+		_pending_release = p.size;
+		return OK;
+	}
+
+	// Frees the payload of the last packet returned by `read_packet_ptr`, if any.
+	void release_packet() {
+		if (_pending_release) {
+			_payload.advance_read(_pending_release);
+			_pending_release = 0;
+		}
+	}
+
 	void discard_payload(int p_size) {
 		_packets.decrease_write(p_size);
 	}
 
 	void resize(int p_pkt_shift, int p_buf_shift) {
+		release_packet();
 		_packets.resize(p_pkt_shift);
 		_payload.resize(p_buf_shift);
 	}
@@ -105,6 +142,7 @@ public:
 	}
 
 	void clear() {
+		_pending_release = 0;
 		_payload.resize(0);
 		_packets.resize(0);
 	}
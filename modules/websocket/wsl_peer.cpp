@@ -206,6 +206,7 @@ void WSLPeer::make_context(PeerData *p_data, unsigned int p_in_buf_size, unsigne
 
 	_in_buffer.resize(p_in_pkt_size, p_in_buf_size);
 	_packet_buffer.resize((1 << MAX(p_in_buf_size, p_out_buf_size)));
+	_out_buffer_size = 1ULL << p_out_buf_size;
 
 	_data = p_data;
 	_data->peer = this;
@@ -232,6 +233,9 @@ void WSLPeer::poll() {
 		return;
 	}
 
+	// The last packet returned by get_packet is only valid until the next poll.
+	_in_buffer.release_packet();
+
 	if (_wsl_poll(_data)) {
 		_data = nullptr;
 	}
@@ -245,8 +249,13 @@ Error WSLPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
 	msg.msg = p_buffer;
 	msg.msg_length = p_buffer_size;
 
-	wslay_event_queue_msg(_data->ctx, &msg);
-	if (wslay_event_send(_data->ctx) < 0) {
+	// Failing to queue (e.g. after close() was called) doesn't break the connection.
+	if (wslay_event_queue_msg(_data->ctx, &msg) != 0) {
+		return FAILED;
+	}
+	// The queue is sent in one batch on the next poll, so many small packets in a frame
+	// don't result in one write each. Send early once it grows past the output buffer size.
+	if (wslay_event_get_queued_msg_length(_data->ctx) >= _out_buffer_size && wslay_event_send(_data->ctx) < 0) {
 		close_now();
 		return FAILED;
 	}
@@ -263,10 +272,18 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 	}
 
 	int read = 0;
-	uint8_t *rw = _packet_buffer.ptrw();
-	_in_buffer.read_packet(rw, _packet_buffer.size(), &_is_string, read);
+	// Hand out the payload directly from the input buffer when possible,
+	// only copy it when it wraps around the end of the ring buffer.
+	// Either way the returned pointer is only valid until the next call to get_packet()
+	// or poll(), as poll() may receive new data over the released part of the ring buffer.
+	Error err = _in_buffer.read_packet_ptr(r_buffer, &_is_string, read);
+	if (err == ERR_BUSY) {
+		uint8_t *rw = _packet_buffer.ptrw();
+		err = _in_buffer.read_packet(rw, _packet_buffer.size(), &_is_string, read);
+		*r_buffer = rw;
+	}
+	ERR_FAIL_COND_V(err != OK, err);
 
-	*r_buffer = rw;
 	r_buffer_size = read;
 
 	return OK;
@@ -331,6 +348,7 @@ void WSLPeer::invalidate() {
 WSLPeer::WSLPeer() {
 	_data = nullptr;
 	_is_string = 0;
+	_out_buffer_size = 0;
 	close_code = -1;
 	write_mode = WRITE_MODE_BINARY;
 }
@@ -86,6 +86,8 @@ private:
 	PacketBuffer<uint8_t> _in_buffer;
 
 	Vector<uint8_t> _packet_buffer;
+	// Queued outgoing bytes are sent right away past this size, otherwise on the next poll.
+	size_t _out_buffer_size;
 
 	WriteMode write_mode;
 
@@ -217,7 +217,6 @@ void AudioStreamPlayer3D::_mix_audio() {
 				continue; //may have been deleted, will be updated on process
 			}
 
-			AudioFrame *target = AudioServer::get_singleton()->thread_get_channel_mix_buffer(current.bus_index, k);
 			current.filter.set_mode(AudioFilterSW::HIGHSHELF);
 			current.filter.set_sampling_rate(AudioServer::get_singleton()->get_mix_rate());
 			current.filter.set_cutoff(attenuation_filter_cutoff_hz);
@@ -225,7 +224,16 @@ void AudioStreamPlayer3D::_mix_audio() {
 			current.filter.set_stages(1);
 			current.filter.set_gain(current.filter_gain);
 
-			if (interpolate_filter) {
+			bool inaudible = MAX(MAX(ABS(target_volume.l), ABS(target_volume.r)), MAX(ABS(vol_prev.l), ABS(vol_prev.r))) <= CMP_EPSILON;
+
+			if (inaudible) {
+				// Nothing would be heard in this channel, don't mix it nor wake its bus up.
+				// Filter history is cleared, as it would have decayed while processing silence.
+				current.filter_process[k * 2 + 0].set_filter(&current.filter);
+				current.filter_process[k * 2 + 1].set_filter(&current.filter);
+			} else if (interpolate_filter) {
+				AudioFrame *target = AudioServer::get_singleton()->thread_get_channel_mix_buffer(current.bus_index, k);
+
 				current.filter_process[k * 2 + 0] = prev_outputs[i].filter_process[k * 2 + 0];
 				current.filter_process[k * 2 + 1] = prev_outputs[i].filter_process[k * 2 + 1];
 
@@ -243,6 +251,8 @@ void AudioStreamPlayer3D::_mix_audio() {
 					vol += vol_inc;
 				}
 			} else {
+				AudioFrame *target = AudioServer::get_singleton()->thread_get_channel_mix_buffer(current.bus_index, k);
+
 				current.filter_process[k * 2 + 0].set_filter(&current.filter);
 				current.filter_process[k * 2 + 1].set_filter(&current.filter);
 
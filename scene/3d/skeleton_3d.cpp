@@ -233,8 +233,9 @@ void Skeleton3D::_notification(int p_what) {
 			_update_process_order();
 
 			const int *order = process_order.ptr();
+			int next_dirty_from = len;
 
-			for (int i = 0; i < len; i++) {
+			for (int i = dirty_from; i < len; i++) {
 				Bone &b = bonesptr[order[i]];
 
 				if (b.global_pose_override_amount >= 0.999) {
@@ -285,6 +286,10 @@ void Skeleton3D::_notification(int p_what) {
 				}
 
 				if (b.global_pose_override_reset) {
+					if (b.global_pose_override_amount > 0.0) {
+						// The override only lasts for this update, the next one must recompute the pose without it.
+						next_dirty_from = MIN(next_dirty_from, i);
+					}
 					b.global_pose_override_amount = 0.0;
 				}
 
@@ -354,6 +359,7 @@ void Skeleton3D::_notification(int p_what) {
 			}
 
 			dirty = false;
+			dirty_from = next_dirty_from;
 
 #ifdef TOOLS_ENABLED
 			emit_signal(SceneStringNames::get_singleton()->pose_updated);
@@ -396,7 +402,7 @@ void Skeleton3D::set_bone_global_pose_override(int p_bone, const Transform &p_po
 	bones.write[p_bone].global_pose_override_amount = p_amount;
 	bones.write[p_bone].global_pose_override = p_pose;
 	bones.write[p_bone].global_pose_override_reset = !p_persistent;
-	_make_dirty();
+	_make_bone_dirty(p_bone);
 }
 
 Transform Skeleton3D::get_bone_global_pose(int p_bone) const {
@@ -538,6 +544,7 @@ void Skeleton3D::bind_child_node_to_bone(int p_bone, Node *p_node) {
 	}
 
 	bones.write[p_bone].nodes_bound.push_back(id);
+	_make_bone_dirty(p_bone, false); // place the node on the next update
 }
 
 void Skeleton3D::unbind_child_node_from_bone(int p_bone, Node *p_node) {
@@ -571,9 +578,7 @@ void Skeleton3D::set_bone_pose(int p_bone, const Transform &p_pose) {
 	ERR_FAIL_INDEX(p_bone, bones.size());
 
 	bones.write[p_bone].pose = p_pose;
-	if (is_inside_tree()) {
-		_make_dirty();
-	}
+	_make_bone_dirty(p_bone, is_inside_tree());
 }
 
 Transform Skeleton3D::get_bone_pose(int p_bone) const {
@@ -588,7 +593,7 @@ void Skeleton3D::set_bone_custom_pose(int p_bone, const Transform &p_custom_pose
 	bones.write[p_bone].custom_pose_enable = (p_custom_pose != Transform());
 	bones.write[p_bone].custom_pose = p_custom_pose;
 
-	_make_dirty();
+	_make_bone_dirty(p_bone);
 }
 
 Transform Skeleton3D::get_bone_custom_pose(int p_bone) const {
@@ -597,6 +602,22 @@ Transform Skeleton3D::get_bone_custom_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	dirty_from = 0;
+	_queue_update();
+}
+
+void Skeleton3D::_make_bone_dirty(int p_bone, bool p_queue_update) {
+	// Bones are processed parents first, so recomputing from this bone's
+	// position in the process order onwards covers its whole subtree.
+	int from = process_order_dirty ? 0 : bones[p_bone].sort_index;
+	dirty_from = MIN(dirty_from, from);
+
+	if (p_queue_update) {
+		_queue_update();
+	}
+}
+
+void Skeleton3D::_queue_update() {
 	if (dirty) {
 		return;
 	}
@@ -929,6 +950,7 @@ void Skeleton3D::_bind_methods() {
 Skeleton3D::Skeleton3D() {
 	animate_physical_bones = true;
 	dirty = false;
+	dirty_from = 0;
 	version = 1;
 	process_order_dirty = true;
 }
@@ -122,7 +122,10 @@ private:
 	bool process_order_dirty;
 
 	void _make_dirty();
+	void _make_bone_dirty(int p_bone, bool p_queue_update = true);
+	void _queue_update();
 	bool dirty;
+	int dirty_from; // position in process_order from which global poses need to be recomputed
 
 	uint64_t version;
 
@@ -166,6 +166,7 @@ private:
 		String name;
 		StringName next;
 		Vector<TrackNodeCache *> node_cache;
+		Vector<int> key_hints; // per track sampling cursor, sized along with node_cache
 		Ref<Animation> animation;
 	};
 
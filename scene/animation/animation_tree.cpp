@@ -519,6 +519,18 @@ AnimationTree::AnimationProcessMode AnimationTree::get_process_mode() const {
 	return process_mode;
 }
 
+void AnimationTree::set_update_interval(int p_frames) {
+	ERR_FAIL_COND(p_frames < 1);
+	update_interval = p_frames;
+	// Spread trees sharing an interval over different frames instead of updating all of them at once.
+	update_frames_pending = (int)((uint64_t)get_instance_id() % (uint64_t)update_interval);
+	update_delta_pending = 0;
+}
+
+int AnimationTree::get_update_interval() const {
+	return update_interval;
+}
+
 void AnimationTree::_node_removed(Node *p_node) {
 	cache_valid = false;
 }
@@ -691,10 +703,16 @@ bool AnimationTree::_update_caches(AnimationPlayer *player) {
 	}
 
 	state.track_map.clear();
+	track_list.clear();
+	animation_track_caches.clear();
 
 	K = nullptr;
 	int idx = 0;
 	while ((K = track_cache.next(K))) {
+		TrackCache *tc = track_cache[*K];
+		tc->blend_idx = idx;
+		tc->root_motion = *K == root_motion_track;
+		track_list.push_back(tc);
 		state.track_map[*K] = idx;
 		idx++;
 	}
@@ -714,9 +732,31 @@ void AnimationTree::_clear_caches() {
 	playing_caches.clear();
 
 	track_cache.clear();
+	track_list.clear();
+	animation_track_caches.clear();
 	cache_valid = false;
 }
 
+AnimationTree::AnimationTrackCaches &AnimationTree::_get_animation_track_caches(const Ref<Animation> &p_animation) {
+	// Track changes clear the caches through the player, the track count check is only a safeguard.
+	AnimationTrackCaches *caches = animation_track_caches.getptr(p_animation->get_instance_id());
+	if (caches && (int)caches->caches.size() == p_animation->get_track_count()) {
+		return *caches;
+	}
+
+	AnimationTrackCaches new_caches;
+	new_caches.caches.resize(p_animation->get_track_count());
+	new_caches.key_hints.resize(p_animation->get_track_count());
+	for (int i = 0; i < p_animation->get_track_count(); i++) {
+		TrackCache *const *track = track_cache.getptr(p_animation->track_get_path(i));
+		new_caches.caches[i] = track ? *track : nullptr;
+		new_caches.key_hints[i] = -1;
+	}
+
+	animation_track_caches.set(p_animation->get_instance_id(), new_caches);
+	return animation_track_caches[p_animation->get_instance_id()];
+}
+
 void AnimationTree::_process_graph(float p_delta) {
 	_update_properties(); //if properties need updating, update them
 
@@ -823,24 +863,23 @@ void AnimationTree::_process_graph(float p_delta) {
 			float delta = as.delta;
 			bool seeked = as.seeked;
 
+			AnimationTrackCaches &animation_caches = _get_animation_track_caches(a);
+			const float *track_blends = as.track_blends->ptr();
+
 			for (int i = 0; i < a->get_track_count(); i++) {
-				NodePath path = a->track_get_path(i);
+				TrackCache *track = animation_caches.caches[i];
 
-				ERR_CONTINUE(!track_cache.has(path));
+				ERR_CONTINUE(!track);
 
-				TrackCache *track = track_cache[path];
 				if (track->type != a->track_get_type(i)) {
 					continue; //may happen should not
 				}
 
-				track->root_motion = root_motion_track == path;
-
-				ERR_CONTINUE(!state.track_map.has(path));
-				int blend_idx = state.track_map[path];
+				int blend_idx = track->blend_idx;
 
 				ERR_CONTINUE(blend_idx < 0 || blend_idx >= state.track_count);
 
-				float blend = (*as.track_blends)[blend_idx];
+				float blend = track_blends[blend_idx];
 
 				if (blend < CMP_EPSILON) {
 					continue; //nothing to blend
@@ -907,7 +946,7 @@ void AnimationTree::_process_graph(float p_delta) {
 							Quat rot;
 							Vector3 scale;
 
-							Error err = a->transform_track_interpolate(i, time, &loc, &rot, &scale);
+							Error err = a->transform_track_interpolate(i, time, &loc, &rot, &scale, &animation_caches.key_hints[i]);
 							//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 							if (t->process_pass != process_pass) {
@@ -1183,9 +1222,8 @@ void AnimationTree::_process_graph(float p_delta) {
 
 	{
 		// finally, set the tracks
-		const NodePath *K = nullptr;
-		while ((K = track_cache.next(K))) {
-			TrackCache *track = track_cache[*K];
+		for (uint32_t i = 0; i < track_list.size(); i++) {
+			TrackCache *track = track_list[i];
 			if (track->process_pass != process_pass) {
 				continue; //not processed, ignore
 			}
@@ -1232,17 +1270,33 @@ void AnimationTree::_process_graph(float p_delta) {
 	}
 }
 
+void AnimationTree::_process_interval(float p_delta) {
+	update_delta_pending += p_delta;
+	update_frames_pending++;
+
+	if (update_frames_pending < update_interval) {
+		root_motion_transform = Transform(); // motion is reported once, on the frame that evaluates it
+		return;
+	}
+
+	float delta = update_delta_pending;
+	update_frames_pending = 0;
+	update_delta_pending = 0;
+
+	_process_graph(delta);
+}
+
 void AnimationTree::advance(float p_time) {
 	_process_graph(p_time);
 }
 
 void AnimationTree::_notification(int p_what) {
 	if (active && p_what == NOTIFICATION_INTERNAL_PHYSICS_PROCESS && process_mode == ANIMATION_PROCESS_PHYSICS) {
-		_process_graph(get_physics_process_delta_time());
+		_process_interval(get_physics_process_delta_time());
 	}
 
 	if (active && p_what == NOTIFICATION_INTERNAL_PROCESS && process_mode == ANIMATION_PROCESS_IDLE) {
-		_process_graph(get_process_delta_time());
+		_process_interval(get_process_delta_time());
 	}
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
@@ -1328,6 +1382,11 @@ String AnimationTree::get_configuration_warning() const {
 
 void AnimationTree::set_root_motion_track(const NodePath &p_track) {
 	root_motion_track = p_track;
+
+	const NodePath *K = nullptr;
+	while ((K = track_cache.next(K))) {
+		track_cache[*K]->root_motion = *K == root_motion_track;
+	}
 }
 
 NodePath AnimationTree::get_root_motion_track() const {
@@ -1488,6 +1547,9 @@ void AnimationTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_mode", "mode"), &AnimationTree::set_process_mode);
 	ClassDB::bind_method(D_METHOD("get_process_mode"), &AnimationTree::get_process_mode);
 
+	ClassDB::bind_method(D_METHOD("set_update_interval", "frames"), &AnimationTree::set_update_interval);
+	ClassDB::bind_method(D_METHOD("get_update_interval"), &AnimationTree::get_update_interval);
+
 	ClassDB::bind_method(D_METHOD("set_animation_player", "root"), &AnimationTree::set_animation_player);
 	ClassDB::bind_method(D_METHOD("get_animation_player"), &AnimationTree::get_animation_player);
 
@@ -1506,6 +1568,7 @@ void AnimationTree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "anim_player", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "AnimationPlayer"), "set_animation_player", "get_animation_player");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_mode", "get_process_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "update_interval", PROPERTY_HINT_RANGE, "1,60,1"), "set_update_interval", "get_update_interval");
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 
@@ -1522,6 +1585,9 @@ AnimationTree::AnimationTree() {
 	process_pass = 1;
 	started = true;
 	properties_dirty = true;
+	update_interval = 1;
+	update_frames_pending = 0;
+	update_delta_pending = 0;
 }
 
 AnimationTree::~AnimationTree() {
@@ -32,6 +32,7 @@
 #define ANIMATION_GRAPH_PLAYER_H
 
 #include "animation_player.h"
+#include "core/local_vector.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/animation.h"
@@ -172,6 +173,7 @@ public:
 private:
 	struct TrackCache {
 		bool root_motion;
+		int blend_idx;
 		uint64_t setup_pass;
 		uint64_t process_pass;
 		Animation::TrackType type;
@@ -180,6 +182,7 @@ private:
 
 		TrackCache() {
 			root_motion = false;
+			blend_idx = -1;
 			setup_pass = 0;
 			process_pass = 0;
 			object = nullptr;
@@ -246,6 +249,14 @@ private:
 	};
 
 	HashMap<NodePath, TrackCache *> track_cache;
+	LocalVector<TrackCache *> track_list; // indexed by blend index, avoids hashing paths every frame
+
+	struct AnimationTrackCaches {
+		LocalVector<TrackCache *> caches; // animation track index -> cache, nullptr if unresolved
+		LocalVector<int> key_hints; // sampling cursor per animation track
+	};
+
+	HashMap<ObjectID, AnimationTrackCaches> animation_track_caches;
 	Set<TrackCache *> playing_caches;
 
 	Ref<AnimationNode> root;
@@ -261,6 +272,8 @@ private:
 
 	void _clear_caches();
 	bool _update_caches(AnimationPlayer *player);
+	void _process_interval(float p_delta);
+	AnimationTrackCaches &_get_animation_track_caches(const Ref<Animation> &p_animation);
 	void _process_graph(float p_delta);
 
 	uint64_t setup_pass;
@@ -268,6 +281,10 @@ private:
 
 	bool started;
 
+	int update_interval;
+	int update_frames_pending;
+	float update_delta_pending;
+
 	NodePath root_motion_track;
 	Transform root_motion_transform;
 
@@ -309,6 +326,9 @@ public:
 	void set_process_mode(AnimationProcessMode p_mode);
 	AnimationProcessMode get_process_mode() const;
 
+	void set_update_interval(int p_frames);
+	int get_update_interval() const;
+
 	void set_animation_player(const NodePath &p_player);
 	NodePath get_animation_player() const;
 
@@ -207,8 +207,8 @@ void Node::_propagate_enter_tree() {
 
 	data.inside_tree = true;
 
-	for (Map<StringName, GroupData>::Element *E = data.grouped.front(); E; E = E->next()) {
-		E->get().group = data.tree->add_to_group(E->key(), this);
+	for (int i = 0; i < data.grouped.size(); i++) {
+		data.grouped.getv(i).group = data.tree->add_to_group(data.grouped.getk(i), this);
 	}
 
 	notification(NOTIFICATION_ENTER_TREE);
@@ -273,9 +273,9 @@ void Node::_propagate_exit_tree() {
 
 	// exit groups
 
-	for (Map<StringName, GroupData>::Element *E = data.grouped.front(); E; E = E->next()) {
-		data.tree->remove_from_group(E->key(), this);
-		E->get().group = nullptr;
+	for (int i = 0; i < data.grouped.size(); i++) {
+		data.tree->remove_from_group(data.grouped.getk(i), this);
+		data.grouped.getv(i).group = nullptr;
 	}
 
 	data.viewport = nullptr;
@@ -326,9 +326,10 @@ void Node::move_child(Node *p_child, int p_pos) {
 	for (int i = motion_from; i <= motion_to; i++) {
 		data.children[i]->notification(NOTIFICATION_MOVED_IN_PARENT);
 	}
-	for (const Map<StringName, GroupData>::Element *E = p_child->data.grouped.front(); E; E = E->next()) {
-		if (E->get().group) {
-			E->get().group->changed = true;
+	const VMap<StringName, GroupData> &child_groups = p_child->data.grouped;
+	for (int i = 0; i < child_groups.size(); i++) {
+		if (child_groups.getv(i).group) {
+			child_groups.getv(i).group->changed = true;
 		}
 	}
 
@@ -363,9 +364,9 @@ void Node::set_physics_process(bool p_process) {
 	data.physics_process = p_process;
 
 	if (data.physics_process) {
-		add_to_group("physics_process", false);
+		add_to_group(SceneStringNames::get_singleton()->physics_process, false);
 	} else {
-		remove_from_group("physics_process");
+		remove_from_group(SceneStringNames::get_singleton()->physics_process);
 	}
 
 	_change_notify("physics_process");
@@ -383,9 +384,9 @@ void Node::set_physics_process_internal(bool p_process_internal) {
 	data.physics_process_internal = p_process_internal;
 
 	if (data.physics_process_internal) {
-		add_to_group("physics_process_internal", false);
+		add_to_group(SceneStringNames::get_singleton()->physics_process_internal, false);
 	} else {
-		remove_from_group("physics_process_internal");
+		remove_from_group(SceneStringNames::get_singleton()->physics_process_internal);
 	}
 
 	_change_notify("physics_process_internal");
@@ -859,9 +860,9 @@ void Node::set_process(bool p_idle_process) {
 	data.idle_process = p_idle_process;
 
 	if (data.idle_process) {
-		add_to_group("idle_process", false);
+		add_to_group(SceneStringNames::get_singleton()->idle_process, false);
 	} else {
-		remove_from_group("idle_process");
+		remove_from_group(SceneStringNames::get_singleton()->idle_process);
 	}
 
 	_change_notify("idle_process");
@@ -879,9 +880,9 @@ void Node::set_process_internal(bool p_idle_process_internal) {
 	data.idle_process_internal = p_idle_process_internal;
 
 	if (data.idle_process_internal) {
-		add_to_group("idle_process_internal", false);
+		add_to_group(SceneStringNames::get_singleton()->idle_process_internal, false);
 	} else {
-		remove_from_group("idle_process_internal");
+		remove_from_group(SceneStringNames::get_singleton()->idle_process_internal);
 	}
 
 	_change_notify("idle_process_internal");
@@ -900,19 +901,19 @@ void Node::set_process_priority(int p_priority) {
 	}
 
 	if (is_processing()) {
-		data.tree->make_group_changed("idle_process");
+		data.tree->make_group_changed(SceneStringNames::get_singleton()->idle_process);
 	}
 
 	if (is_processing_internal()) {
-		data.tree->make_group_changed("idle_process_internal");
+		data.tree->make_group_changed(SceneStringNames::get_singleton()->idle_process_internal);
 	}
 
 	if (is_physics_processing()) {
-		data.tree->make_group_changed("physics_process");
+		data.tree->make_group_changed(SceneStringNames::get_singleton()->physics_process);
 	}
 
 	if (is_physics_processing_internal()) {
-		data.tree->make_group_changed("physics_process_internal");
+		data.tree->make_group_changed(SceneStringNames::get_singleton()->physics_process_internal);
 	}
 }
 
@@ -986,7 +987,13 @@ StringName Node::get_name() const {
 }
 
 void Node::_set_name_nocheck(const StringName &p_name) {
+	if (data.parent) {
+		data.parent->_child_name_index_erase(this);
+	}
 	data.name = p_name;
+	if (data.parent) {
+		data.parent->_child_name_index_insert(this);
+	}
 }
 
 String Node::invalid_character = ". : @ / \"";
@@ -1007,10 +1014,16 @@ void Node::set_name(const String &p_name) {
 	_validate_node_name(name);
 
 	ERR_FAIL_COND(name == "");
+
+	if (data.parent) {
+		data.parent->_child_name_index_erase(this);
+	}
+
 	data.name = name;
 
 	if (data.parent) {
 		data.parent->_validate_child_name(this);
+		data.parent->_child_name_index_insert(this);
 	}
 
 	propagate_notification(NOTIFICATION_PATH_CHANGED);
@@ -1022,6 +1035,9 @@ void Node::set_name(const String &p_name) {
 	}
 }
 
+// Parents with at least this many children keep a name -> child index for lookups.
+static const int CHILD_NAME_INDEX_MIN_CHILDREN = 32;
+
 static bool node_hrcr = false;
 static SafeRefCount node_hrcr_count;
 
@@ -1063,18 +1079,7 @@ void Node::_validate_child_name(Node *p_child, bool p_force_human_readable) {
 			unique = false;
 		} else {
 			//check if exists
-			Node **children = data.children.ptrw();
-			int cc = data.children.size();
-
-			for (int i = 0; i < cc; i++) {
-				if (children[i] == p_child) {
-					continue;
-				}
-				if (children[i]->data.name == p_child->data.name) {
-					unique = false;
-					break;
-				}
-			}
+			unique = !_has_child_named(p_child->data.name, p_child);
 		}
 
 		if (!unique) {
@@ -1130,25 +1135,9 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		}
 	}
 
-	//quickly test if proposed name exists
-	int cc = data.children.size(); //children count
-	const Node *const *children_ptr = data.children.ptr();
-
-	{
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) { //exclude self in renaming if its already a child
-				continue;
-			}
-			if (children_ptr[i]->data.name == name) {
-				exists = true;
-			}
-		}
-
-		if (!exists) {
-			return; //if it does not exist, it does not need validation
-		}
+	//quickly test if proposed name exists, excluding self in renaming if its already a child
+	if (!_has_child_named(name, p_child)) {
+		return; //if it does not exist, it does not need validation
 	}
 
 	// Extract trailing number
@@ -1175,18 +1164,8 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 
 	for (;;) {
 		StringName attempt = name_string + nums;
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) {
-				continue;
-			}
-			if (children_ptr[i]->data.name == attempt) {
-				exists = true;
-			}
-		}
 
-		if (!exists) {
+		if (!_has_child_named(attempt, p_child)) {
 			name = attempt;
 			return;
 		} else {
@@ -1208,6 +1187,15 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	p_child->data.pos = data.children.size();
 	data.children.push_back(p_child);
 	p_child->data.parent = this;
+
+	if (data.children_indexed) {
+		_child_name_index_insert(p_child);
+	} else if (data.children.size() >= CHILD_NAME_INDEX_MIN_CHILDREN) {
+		data.children_indexed = true;
+		for (int i = 0; i < data.children.size(); i++) {
+			_child_name_index_insert(data.children[i]);
+		}
+	}
 	p_child->notification(NOTIFICATION_PARENTED);
 
 	if (data.tree) {
@@ -1300,8 +1288,14 @@ void Node::remove_child(Node *p_child) {
 	remove_child_notify(p_child);
 	p_child->notification(NOTIFICATION_UNPARENTED);
 
+	_child_name_index_erase(p_child);
 	data.children.remove(idx);
 
+	if (data.children_indexed && data.children.size() < CHILD_NAME_INDEX_MIN_CHILDREN / 2) {
+		data.children_by_name.clear();
+		data.children_indexed = false;
+	}
+
 	//update pointer and size
 	child_count = data.children.size();
 	children = data.children.ptrw();
@@ -1336,6 +1330,11 @@ Node *Node::get_child(int p_index) const {
 }
 
 Node *Node::_get_child_by_name(const StringName &p_name) const {
+	if (data.children_indexed) {
+		Node *const *child = data.children_by_name.getptr(p_name);
+		return child ? *child : nullptr;
+	}
+
 	int cc = data.children.size();
 	Node *const *cd = data.children.ptr();
 
@@ -1348,6 +1347,60 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	return nullptr;
 }
 
+bool Node::_has_child_named(const StringName &p_name, const Node *p_exclude) const {
+	if (data.children_indexed) {
+		Node *const *child = data.children_by_name.getptr(p_name);
+		return child && *child != p_exclude;
+	}
+
+	int cc = data.children.size();
+	Node *const *cd = data.children.ptr();
+
+	for (int i = 0; i < cc; i++) {
+		if (cd[i] != p_exclude && cd[i]->data.name == p_name) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Node::_child_name_index_insert(Node *p_child) {
+	if (!data.children_indexed) {
+		return;
+	}
+
+	// Keep the first child added under a name, so lookups resolve the same way a linear scan would.
+	if (!data.children_by_name.has(p_child->data.name)) {
+		data.children_by_name.set(p_child->data.name, p_child);
+	}
+}
+
+void Node::_child_name_index_erase(Node *p_child) {
+	if (!data.children_indexed) {
+		return;
+	}
+
+	Node **child = data.children_by_name.getptr(p_child->data.name);
+	if (!child || *child != p_child) {
+		return;
+	}
+
+	// Names are normally unique, but children added with _add_child_nocheck() are not validated;
+	// hand the name over to the next child that shares it, if any.
+	int cc = data.children.size();
+	Node *const *cd = data.children.ptr();
+
+	for (int i = 0; i < cc; i++) {
+		if (cd[i] != p_child && cd[i]->data.name == p_child->data.name) {
+			*child = cd[i];
+			return;
+		}
+	}
+
+	data.children_by_name.erase(p_child->data.name);
+}
+
 Node *Node::get_node_or_null(const NodePath &p_path) const {
 	if (p_path.is_empty()) {
 		return nullptr;
@@ -1388,16 +1441,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 		} else {
-			next = nullptr;
-
-			for (int j = 0; j < current->data.children.size(); j++) {
-				Node *child = current->data.children[j];
-
-				if (child->data.name == name) {
-					next = child;
-					break;
-				}
-			}
+			next = current->_get_child_by_name(name);
 			if (next == nullptr) {
 				return nullptr;
 			};
@@ -1713,21 +1757,17 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 
 	gd.persistent = p_persistent;
 
-	data.grouped[p_identifier] = gd;
+	data.grouped.insert(p_identifier, gd);
 }
 
 void Node::remove_from_group(const StringName &p_identifier) {
 	ERR_FAIL_COND(!data.grouped.has(p_identifier));
 
-	Map<StringName, GroupData>::Element *E = data.grouped.find(p_identifier);
-
-	ERR_FAIL_COND(!E);
-
 	if (data.tree) {
-		data.tree->remove_from_group(E->key(), this);
+		data.tree->remove_from_group(p_identifier, this);
 	}
 
-	data.grouped.erase(E);
+	data.grouped.erase(p_identifier);
 }
 
 Array Node::_get_groups() const {
@@ -1742,10 +1782,10 @@ Array Node::_get_groups() const {
 }
 
 void Node::get_groups(List<GroupInfo> *p_groups) const {
-	for (const Map<StringName, GroupData>::Element *E = data.grouped.front(); E; E = E->next()) {
+	for (int i = 0; i < data.grouped.size(); i++) {
 		GroupInfo gi;
-		gi.name = E->key();
-		gi.persistent = E->get().persistent;
+		gi.name = data.grouped.getk(i);
+		gi.persistent = data.grouped.getv(i).persistent;
 		p_groups->push_back(gi);
 	}
 }
@@ -1753,8 +1793,8 @@ void Node::get_groups(List<GroupInfo> *p_groups) const {
 int Node::get_persistent_group_count() const {
 	int count = 0;
 
-	for (const Map<StringName, GroupData>::Element *E = data.grouped.front(); E; E = E->next()) {
-		if (E->get().persistent) {
+	for (int i = 0; i < data.grouped.size(); i++) {
+		if (data.grouped.getv(i).persistent) {
 			count += 1;
 		}
 	}
@@ -2927,6 +2967,7 @@ String Node::_get_name_num_separator() {
 Node::Node() {
 	data.pos = -1;
 	data.depth = -1;
+	data.children_indexed = false;
 	data.blocked = 0;
 	data.parent = nullptr;
 	data.tree = nullptr;
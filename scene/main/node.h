@@ -38,6 +38,7 @@
 #include "core/project_settings.h"
 #include "core/script_language.h"
 #include "core/typed_array.h"
+#include "core/vmap.h"
 #include "scene/main/scene_tree.h"
 
 class Viewport;
@@ -97,6 +98,8 @@ private:
 		Node *parent;
 		Node *owner;
 		Vector<Node *> children; // list of children
+		HashMap<StringName, Node *> children_by_name; // only kept once there are many children, see _get_child_by_name()
+		bool children_indexed;
 		int pos;
 		int depth;
 		int blocked; // safeguard that throws an error when attempting to modify the tree in a harmful way while being traversed.
@@ -111,7 +114,7 @@ private:
 
 		Viewport *viewport;
 
-		Map<StringName, GroupData> grouped;
+		VMap<StringName, GroupData> grouped; // nodes rarely have more than a few groups, keep them in a flat sorted array
 		List<Node *>::Element *OW; // owned element
 		List<Node *> owned;
 
@@ -157,6 +160,9 @@ private:
 	void _print_tree(const Node *p_node);
 
 	Node *_get_child_by_name(const StringName &p_name) const;
+	bool _has_child_named(const StringName &p_name, const Node *p_exclude) const;
+	void _child_name_index_insert(Node *p_child);
+	void _child_name_index_erase(Node *p_child);
 
 	void _replace_connections_target(Node *p_new_target);
 
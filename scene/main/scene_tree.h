@@ -32,6 +32,7 @@
 #define SCENE_TREE_H
 
 #include "core/io/multiplayer_api.h"
+#include "core/local_vector.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
 #include "core/self_list.h"
@@ -126,7 +127,7 @@ private:
 	int call_lock;
 	Set<Node *> call_skip; //skip erased nodes
 
-	List<ObjectID> delete_queue;
+	LocalVector<ObjectID> delete_queue;
 
 	Map<UGCall, Vector<Variant>> unique_group_calls;
 	bool ugc_locked;
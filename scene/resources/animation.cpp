@@ -1450,6 +1450,33 @@ int Animation::_find(const Vector<K> &p_keys, float p_time) const {
 	return middle;
 }
 
+template <class K>
+int Animation::_find_hinted(const Vector<K> &p_keys, float p_time, int *r_key_hint) const {
+	int len = p_keys.size();
+	const K *keys = p_keys.ptr();
+
+	// During playback the key is usually the same as last time or the one right after it.
+	// Only accept it when _find() could not have matched a neighbor key approximately.
+	for (int idx = *r_key_hint; idx <= *r_key_hint + 1; idx++) {
+		if (idx < 0 || idx >= len || keys[idx].time > p_time) {
+			continue;
+		}
+		if (idx > 0 && Math::is_equal_approx(p_time, keys[idx - 1].time)) {
+			continue;
+		}
+		if (idx + 1 < len && (keys[idx + 1].time <= p_time || Math::is_equal_approx(p_time, keys[idx + 1].time))) {
+			continue;
+		}
+
+		*r_key_hint = idx;
+		return idx;
+	}
+
+	int idx = _find(p_keys, p_time);
+	*r_key_hint = idx;
+	return idx;
+}
+
 Animation::TransformKey Animation::_interpolate(const Animation::TransformKey &p_a, const Animation::TransformKey &p_b, float p_c) const {
 	TransformKey ret;
 	ret.loc = _interpolate(p_a.loc, p_b.loc, p_c);
@@ -1585,8 +1612,11 @@ float Animation::_cubic_interpolate(const float &p_pre_a, const float &p_a, cons
 }
 
 template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, int *r_key_hint) const {
+	int len = p_keys.size();
+	if (len > 0 && p_keys[len - 1].time > length && !Math::is_equal_approx(length, p_keys[len - 1].time)) {
+		len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+	}
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -1603,7 +1633,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time);
+	int idx = r_key_hint ? _find_hinted(p_keys, p_time, r_key_hint) : _find(p_keys, p_time);
 
 	ERR_FAIL_COND_V(idx == -2, T());
 
@@ -1729,7 +1759,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 	// do a barrel roll
 }
 
-Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const {
+Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, int *r_key_hint) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
@@ -1738,7 +1768,7 @@ Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3
 
 	bool ok = false;
 
-	TransformKey tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	TransformKey tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok, r_key_hint);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -45,6 +45,44 @@ bool SceneState::can_instance() const {
 	return nodes.size() > 0;
 }
 
+void SceneState::_build_instance_plan() const {
+	int nc = nodes.size();
+	instance_plan.resize(nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		NodeInstancePlan &plan = instance_plan.write[i];
+		plan.type = StringName();
+		plan.setters.clear();
+
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANCED || n.properties.empty()) {
+			continue; // Not created by this scene, its class is only known once instanced.
+		}
+
+		plan.type = names[n.type];
+		plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const ClassDB::PropertySetGet *psg = nullptr;
+			int name = n.properties[j].name;
+			if (name >= 0 && name < names.size() && names[name] != CoreStringNames::get_singleton()->_script) {
+				psg = ClassDB::get_property_setget(plan.type, names[name]);
+				if (psg && !psg->_setptr) {
+					psg = nullptr; // Setter is only reachable through a call by name.
+				}
+			}
+			plan.setters.write[j] = psg;
+		}
+	}
+
+	instance_plan_valid = true;
+}
+
+void SceneState::_invalidate_instance_plan() {
+	MutexLock lock(instance_plan_mutex);
+	instance_plan_valid = false;
+	instance_plan.clear();
+}
+
 Node *SceneState::instance(GenEditState p_edit_state) const {
 	// nodes where instancing failed (because something is missing)
 	List<Node *> stray_instances;
@@ -78,6 +116,16 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 
 	const NodeData *nd = &nodes[0];
 
+	// The cached setters are only used at runtime, the editor needs properties to go through Object::set.
+	const NodeInstancePlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED) {
+		MutexLock lock(instance_plan_mutex);
+		if (!instance_plan_valid) {
+			_build_instance_plan();
+		}
+		plan = instance_plan.ptr();
+	}
+
 	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.empty();
@@ -187,6 +235,12 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// Setters can only be called directly if the node is of the class they were resolved for.
+				const ClassDB::PropertySetGet *const *nsetters = nullptr;
+				if (plan && plan[i].setters.size() == nprop_count && plan[i].type == node->get_class_name()) {
+					nsetters = plan[i].setters.ptr();
+				}
+
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 					ERR_FAIL_INDEX_V(nprops[j].name, sname_count, nullptr);
@@ -243,7 +297,19 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 						} else if (p_edit_state == GEN_EDIT_STATE_INSTANCE) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor
 						}
-						node->set(snames[nprops[j].name], value, &valid);
+
+						// A script may override the property, in which case it must go through Object::set.
+						if (nsetters && nsetters[j] && !node->get_script_instance()) {
+							ClassDB::set_property_with_setget(node, nsetters[j], value, &valid);
+#ifdef TOOLS_ENABLED
+							// Object::set() is skipped, flag the node as it would.
+							if (!node->is_edited()) {
+								node->set_edited(true);
+							}
+#endif
+						} else {
+							node->set(snames[nprops[j].name], value, &valid);
+						}
 					}
 				}
 			}
@@ -900,6 +966,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_invalidate_instance_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1071,6 +1138,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	const Vector<int> sconns = p_dictionary["conns"];
 	ERR_FAIL_COND(sconns.size() < conn_count);
 
+	_invalidate_instance_plan();
+
 	Vector<String> snames = p_dictionary["names"];
 	if (snames.size()) {
 		int namecount = snames.size();
@@ -1511,6 +1580,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	_invalidate_instance_plan();
 
 	return nodes.size() - 1;
 }
@@ -1524,6 +1594,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value) {
 	prop.name = p_name;
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	_invalidate_instance_plan();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -1535,6 +1606,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	_invalidate_instance_plan();
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, const Vector<int> &p_binds) {
@@ -88,6 +88,20 @@ class SceneState : public Reference {
 
 	Vector<ConnectionData> connections;
 
+	// Property setters of each node resolved from ClassDB the first time the scene
+	// is instanced, so instancing doesn't look every property up by name again.
+	struct NodeInstancePlan {
+		StringName type; // Class the setters were resolved for.
+		Vector<const ClassDB::PropertySetGet *> setters; // One per property, nullptr if it must go through Object::set.
+	};
+
+	mutable Vector<NodeInstancePlan> instance_plan;
+	mutable bool instance_plan_valid = false;
+	mutable Mutex instance_plan_mutex;
+
+	void _build_instance_plan() const;
+	void _invalidate_instance_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 
@@ -31,6 +31,7 @@
 #include "surface_tool.h"
 
 #include "core/method_bind_ext.gen.inc"
+#include "core/oa_hash_map.h"
 
 #define _VERTEX_SNAP 0.0001
 #define EQ_VERTEX_DIST 0.00001
@@ -286,9 +287,8 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len);
 				Vector3 *w = array.ptrw();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx++) {
-					const Vertex &v = E->get();
+				for (uint32_t idx = 0; idx < vertex_array.size(); idx++) {
+					const Vertex &v = vertex_array[idx];
 
 					switch (i) {
 						case Mesh::ARRAY_VERTEX: {
@@ -310,9 +310,8 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len);
 				Vector2 *w = array.ptrw();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx++) {
-					const Vertex &v = E->get();
+				for (uint32_t idx = 0; idx < vertex_array.size(); idx++) {
+					const Vertex &v = vertex_array[idx];
 
 					switch (i) {
 						case Mesh::ARRAY_TEX_UV: {
@@ -331,17 +330,16 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len * 4);
 				float *w = array.ptrw();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx += 4) {
-					const Vertex &v = E->get();
+				for (uint32_t idx = 0; idx < vertex_array.size(); idx++) {
+					const Vertex &v = vertex_array[idx];
 
-					w[idx + 0] = v.tangent.x;
-					w[idx + 1] = v.tangent.y;
-					w[idx + 2] = v.tangent.z;
+					w[idx * 4 + 0] = v.tangent.x;
+					w[idx * 4 + 1] = v.tangent.y;
+					w[idx * 4 + 2] = v.tangent.z;
 
 					//float d = v.tangent.dot(v.binormal,v.normal);
 					float d = v.binormal.dot(v.normal.cross(v.tangent));
-					w[idx + 3] = d < 0 ? -1 : 1;
+					w[idx * 4 + 3] = d < 0 ? -1 : 1;
 				}
 
 				a[i] = array;
@@ -352,10 +350,8 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len);
 				Color *w = array.ptrw();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx++) {
-					const Vertex &v = E->get();
-					w[idx] = v.color;
+				for (uint32_t idx = 0; idx < vertex_array.size(); idx++) {
+					w[idx] = vertex_array[idx].color;
 				}
 
 				a[i] = array;
@@ -365,14 +361,13 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len * 4);
 				int *w = array.ptrw();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx += 4) {
-					const Vertex &v = E->get();
+				for (uint32_t idx = 0; idx < vertex_array.size(); idx++) {
+					const Vertex &v = vertex_array[idx];
 
 					ERR_CONTINUE(v.bones.size() != 4);
 
 					for (int j = 0; j < 4; j++) {
-						w[idx + j] = v.bones[j];
+						w[idx * 4 + j] = v.bones[j];
 					}
 				}
 
@@ -384,13 +379,12 @@ Array SurfaceTool::commit_to_arrays() {
 				array.resize(varr_len * 4);
 				float *w = array.ptrw();
 
-				int idx = 0;
-				for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next(), idx += 4) {
-					const Vertex &v = E->get();
+				for (uint32_t idx = 0; idx < vertex_array.size(); idx++) {
+					const Vertex &v = vertex_array[idx];
 					ERR_CONTINUE(v.weights.size() != 4);
 
 					for (int j = 0; j < 4; j++) {
-						w[idx + j] = v.weights[j];
+						w[idx * 4 + j] = v.weights[j];
 					}
 				}
 
@@ -402,12 +396,7 @@ Array SurfaceTool::commit_to_arrays() {
 
 				Vector<int> array;
 				array.resize(index_array.size());
-				int *w = array.ptrw();
-
-				int idx = 0;
-				for (List<int>::Element *E = index_array.front(); E; E = E->next(), idx++) {
-					w[idx] = E->get();
-				}
+				copymem(array.ptrw(), index_array.ptr(), index_array.size() * sizeof(int));
 
 				a[i] = array;
 			} break;
@@ -452,24 +441,25 @@ void SurfaceTool::index() {
 		return; //already indexed
 	}
 
-	HashMap<Vertex, int, VertexHasher> indices;
-	List<Vertex> new_vertices;
+	OAHashMap<Vertex, int, VertexHasher> indices(vertex_array.size());
+	LocalVector<Vertex> new_vertices;
 
-	for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next()) {
-		int *idxptr = indices.getptr(E->get());
+	index_array.resize(vertex_array.size());
+	for (uint32_t vi = 0; vi < vertex_array.size(); vi++) {
+		const Vertex &vertex = vertex_array[vi];
+		int *idxptr = indices.lookup_ptr(vertex);
 		int idx;
 		if (!idxptr) {
-			idx = indices.size();
-			new_vertices.push_back(E->get());
-			indices[E->get()] = idx;
+			idx = new_vertices.size();
+			new_vertices.push_back(vertex);
+			indices.insert(vertex, idx);
 		} else {
 			idx = *idxptr;
 		}
 
-		index_array.push_back(idx);
+		index_array[vi] = idx;
 	}
 
-	vertex_array.clear();
 	vertex_array = new_vertices;
 
 	format |= Mesh::ARRAY_FORMAT_INDEX;
@@ -479,22 +469,19 @@ void SurfaceTool::deindex() {
 	if (index_array.size() == 0) {
 		return; //nothing to deindex
 	}
-	Vector<Vertex> varr;
-	varr.resize(vertex_array.size());
-	int idx = 0;
-	for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next()) {
-		varr.write[idx++] = E->get();
-	}
+	LocalVector<Vertex> old_vertex_array = vertex_array;
 	vertex_array.clear();
-	for (List<int>::Element *E = index_array.front(); E; E = E->next()) {
-		ERR_FAIL_INDEX(E->get(), varr.size());
-		vertex_array.push_back(varr[E->get()]);
+	vertex_array.reserve(index_array.size());
+	for (uint32_t i = 0; i < index_array.size(); i++) {
+		int index = index_array[i];
+		ERR_FAIL_INDEX(index, (int)old_vertex_array.size());
+		vertex_array.push_back(old_vertex_array[index]);
 	}
 	format &= ~Mesh::ARRAY_FORMAT_INDEX;
 	index_array.clear();
 }
 
-void SurfaceTool::_create_list(const Ref<Mesh> &p_existing, int p_surface, List<Vertex> *r_vertex, List<int> *r_index, int &lformat) {
+void SurfaceTool::_create_list(const Ref<Mesh> &p_existing, int p_surface, LocalVector<Vertex> *r_vertex, LocalVector<int> *r_index, int &lformat) {
 	Array arr = p_existing->surface_get_arrays(p_surface);
 	ERR_FAIL_COND(arr.size() != RS::ARRAY_MAX);
 	_create_list_from_arrays(arr, r_vertex, r_index, lformat);
@@ -590,7 +577,7 @@ Vector<SurfaceTool::Vertex> SurfaceTool::create_vertex_array_from_triangle_array
 	return ret;
 }
 
-void SurfaceTool::_create_list_from_arrays(Array arr, List<Vertex> *r_vertex, List<int> *r_index, int &lformat) {
+void SurfaceTool::_create_list_from_arrays(Array arr, LocalVector<Vertex> *r_vertex, LocalVector<int> *r_index, int &lformat) {
 	Vector<Vector3> varr = arr[RS::ARRAY_VERTEX];
 	Vector<Vector3> narr = arr[RS::ARRAY_NORMAL];
 	Vector<float> tarr = arr[RS::ARRAY_TANGENT];
@@ -631,6 +618,7 @@ void SurfaceTool::_create_list_from_arrays(Array arr, List<Vertex> *r_vertex, Li
 		lformat |= RS::ARRAY_FORMAT_WEIGHTS;
 	}
 
+	r_vertex->reserve(r_vertex->size() + vc);
 	for (int i = 0; i < vc; i++) {
 		Vertex v;
 		if (lformat & RS::ARRAY_FORMAT_VERTEX) {
@@ -682,9 +670,9 @@ void SurfaceTool::_create_list_from_arrays(Array arr, List<Vertex> *r_vertex, Li
 	if (is) {
 		lformat |= RS::ARRAY_FORMAT_INDEX;
 		const int *iarr = idx.ptr();
-		for (int i = 0; i < is; i++) {
-			r_index->push_back(iarr[i]);
-		}
+		uint32_t index_from = r_index->size();
+		r_index->resize(index_from + is);
+		copymem(r_index->ptr() + index_from, iarr, is * sizeof(int));
 	}
 }
 
@@ -728,14 +716,15 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 	}
 
 	int nformat;
-	List<Vertex> nvertices;
-	List<int> nindices;
+	LocalVector<Vertex> nvertices;
+	LocalVector<int> nindices;
 	_create_list(p_existing, p_surface, &nvertices, &nindices, nformat);
 	format |= nformat;
 	int vfrom = vertex_array.size();
 
-	for (List<Vertex>::Element *E = nvertices.front(); E; E = E->next()) {
-		Vertex v = E->get();
+	vertex_array.reserve(vertex_array.size() + nvertices.size());
+	for (uint32_t vi = 0; vi < nvertices.size(); vi++) {
+		Vertex v = nvertices[vi];
 		v.vertex = p_xform.xform(v.vertex);
 		if (nformat & RS::ARRAY_FORMAT_NORMAL) {
 			v.normal = p_xform.basis.xform(v.normal);
@@ -748,8 +737,9 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 		vertex_array.push_back(v);
 	}
 
-	for (List<int>::Element *E = nindices.front(); E; E = E->next()) {
-		int dst_index = E->get() + vfrom;
+	index_array.reserve(index_array.size() + nindices.size());
+	for (uint32_t i = 0; i < nindices.size(); i++) {
+		int dst_index = nindices[i] + vfrom;
 		index_array.push_back(dst_index);
 	}
 	if (index_array.size() % 3) {
@@ -760,18 +750,18 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 //mikktspace callbacks
 namespace {
 struct TangentGenerationContextUserData {
-	Vector<List<SurfaceTool::Vertex>::Element *> vertices;
-	Vector<List<int>::Element *> indices;
+	LocalVector<SurfaceTool::Vertex> *vertices;
+	LocalVector<int> *indices;
 };
 } // namespace
 
 int SurfaceTool::mikktGetNumFaces(const SMikkTSpaceContext *pContext) {
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 
-	if (triangle_data.indices.size() > 0) {
-		return triangle_data.indices.size() / 3;
+	if (triangle_data.indices->size() > 0) {
+		return triangle_data.indices->size() / 3;
 	} else {
-		return triangle_data.vertices.size() / 3;
+		return triangle_data.vertices->size() / 3;
 	}
 }
 
@@ -782,13 +772,13 @@ int SurfaceTool::mikktGetNumVerticesOfFace(const SMikkTSpaceContext *pContext, c
 void SurfaceTool::mikktGetPosition(const SMikkTSpaceContext *pContext, float fvPosOut[], const int iFace, const int iVert) {
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vector3 v;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			v = triangle_data.vertices[index]->get().vertex;
+	if (triangle_data.indices->size() > 0) {
+		uint32_t index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			v = (*triangle_data.vertices)[index].vertex;
 		}
 	} else {
-		v = triangle_data.vertices[iFace * 3 + iVert]->get().vertex;
+		v = (*triangle_data.vertices)[iFace * 3 + iVert].vertex;
 	}
 
 	fvPosOut[0] = v.x;
@@ -799,13 +789,13 @@ void SurfaceTool::mikktGetPosition(const SMikkTSpaceContext *pContext, float fvP
 void SurfaceTool::mikktGetNormal(const SMikkTSpaceContext *pContext, float fvNormOut[], const int iFace, const int iVert) {
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vector3 v;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			v = triangle_data.vertices[index]->get().normal;
+	if (triangle_data.indices->size() > 0) {
+		uint32_t index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			v = (*triangle_data.vertices)[index].normal;
 		}
 	} else {
-		v = triangle_data.vertices[iFace * 3 + iVert]->get().normal;
+		v = (*triangle_data.vertices)[iFace * 3 + iVert].normal;
 	}
 
 	fvNormOut[0] = v.x;
@@ -816,13 +806,13 @@ void SurfaceTool::mikktGetNormal(const SMikkTSpaceContext *pContext, float fvNor
 void SurfaceTool::mikktGetTexCoord(const SMikkTSpaceContext *pContext, float fvTexcOut[], const int iFace, const int iVert) {
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vector2 v;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			v = triangle_data.vertices[index]->get().uv;
+	if (triangle_data.indices->size() > 0) {
+		uint32_t index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			v = (*triangle_data.vertices)[index].uv;
 		}
 	} else {
-		v = triangle_data.vertices[iFace * 3 + iVert]->get().uv;
+		v = (*triangle_data.vertices)[iFace * 3 + iVert].uv;
 	}
 
 	fvTexcOut[0] = v.x;
@@ -833,13 +823,13 @@ void SurfaceTool::mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, cons
 		const tbool bIsOrientationPreserving, const int iFace, const int iVert) {
 	TangentGenerationContextUserData &triangle_data = *reinterpret_cast<TangentGenerationContextUserData *>(pContext->m_pUserData);
 	Vertex *vtx = nullptr;
-	if (triangle_data.indices.size() > 0) {
-		int index = triangle_data.indices[iFace * 3 + iVert]->get();
-		if (index < triangle_data.vertices.size()) {
-			vtx = &triangle_data.vertices[index]->get();
+	if (triangle_data.indices->size() > 0) {
+		uint32_t index = (*triangle_data.indices)[iFace * 3 + iVert];
+		if (index < triangle_data.vertices->size()) {
+			vtx = &(*triangle_data.vertices)[index];
 		}
 	} else {
-		vtx = &triangle_data.vertices[iFace * 3 + iVert]->get();
+		vtx = &(*triangle_data.vertices)[iFace * 3 + iVert];
 	}
 
 	if (vtx != nullptr) {
@@ -865,18 +855,12 @@ void SurfaceTool::generate_tangents() {
 	msc.m_pInterface = &mkif;
 
 	TangentGenerationContextUserData triangle_data;
-	triangle_data.vertices.resize(vertex_array.size());
-	int idx = 0;
-	for (List<Vertex>::Element *E = vertex_array.front(); E; E = E->next()) {
-		triangle_data.vertices.write[idx++] = E;
-		E->get().binormal = Vector3();
-		E->get().tangent = Vector3();
-	}
-	triangle_data.indices.resize(index_array.size());
-	idx = 0;
-	for (List<int>::Element *E = index_array.front(); E; E = E->next()) {
-		triangle_data.indices.write[idx++] = E;
+	triangle_data.vertices = &vertex_array;
+	for (uint32_t i = 0; i < vertex_array.size(); i++) {
+		vertex_array[i].binormal = Vector3();
+		vertex_array[i].tangent = Vector3();
 	}
+	triangle_data.indices = &index_array;
 	msc.m_pUserData = &triangle_data;
 
 	bool res = genTangSpaceDefault(&msc);
@@ -900,48 +884,45 @@ void SurfaceTool::generate_normals(bool p_flip) {
 		smooth = smooth_groups[0];
 	}
 
-	List<Vertex>::Element *B = vertex_array.front();
-	for (List<Vertex>::Element *E = B; E;) {
-		List<Vertex>::Element *v[3];
-		v[0] = E;
-		v[1] = v[0]->next();
-		ERR_FAIL_COND(!v[1]);
-		v[2] = v[1]->next();
-		ERR_FAIL_COND(!v[2]);
-		E = v[2]->next();
+	ERR_FAIL_COND(vertex_array.size() % 3);
+
+	uint32_t B = 0;
+	for (uint32_t E = 0; E < vertex_array.size();) {
+		Vertex *v = &vertex_array[E];
+		E += 3;
 
 		Vector3 normal;
 		if (!p_flip) {
-			normal = Plane(v[0]->get().vertex, v[1]->get().vertex, v[2]->get().vertex).normal;
+			normal = Plane(v[0].vertex, v[1].vertex, v[2].vertex).normal;
 		} else {
-			normal = Plane(v[2]->get().vertex, v[1]->get().vertex, v[0]->get().vertex).normal;
+			normal = Plane(v[2].vertex, v[1].vertex, v[0].vertex).normal;
 		}
 
 		if (smooth) {
 			for (int i = 0; i < 3; i++) {
-				Vector3 *lv = vertex_hash.getptr(v[i]->get());
+				Vector3 *lv = vertex_hash.getptr(v[i]);
 				if (!lv) {
-					vertex_hash.set(v[i]->get(), normal);
+					vertex_hash.set(v[i], normal);
 				} else {
 					(*lv) += normal;
 				}
 			}
 		} else {
 			for (int i = 0; i < 3; i++) {
-				v[i]->get().normal = normal;
+				v[i].normal = normal;
 			}
 		}
 		count += 3;
 
-		if (smooth_groups.has(count) || !E) {
+		if (smooth_groups.has(count) || E == vertex_array.size()) {
 			if (vertex_hash.size()) {
 				while (B != E) {
-					Vector3 *lv = vertex_hash.getptr(B->get());
+					Vector3 *lv = vertex_hash.getptr(vertex_array[B]);
 					if (lv) {
-						B->get().normal = lv->normalized();
+						vertex_array[B].normal = lv->normalized();
 					}
 
-					B = B->next();
+					B++;
 				}
 
 			} else {
@@ -949,7 +930,7 @@ void SurfaceTool::generate_normals(bool p_flip) {
 			}
 
 			vertex_hash.clear();
-			if (E) {
+			if (E != vertex_array.size()) {
 				smooth = smooth_groups[count];
 			}
 		}
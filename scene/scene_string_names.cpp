@@ -33,181 +33,185 @@
 SceneStringNames *SceneStringNames::singleton = nullptr;
 
 SceneStringNames::SceneStringNames() {
-	_estimate_cost = StaticCString::create("_estimate_cost");
-	_compute_cost = StaticCString::create("_compute_cost");
+	_estimate_cost = STATIC_SNAME("_estimate_cost");
+	_compute_cost = STATIC_SNAME("_compute_cost");
 
-	resized = StaticCString::create("resized");
-	dot = StaticCString::create(".");
-	doubledot = StaticCString::create("..");
-	draw = StaticCString::create("draw");
-	_draw = StaticCString::create("_draw");
-	hide = StaticCString::create("hide");
-	visibility_changed = StaticCString::create("visibility_changed");
-	input_event = StaticCString::create("input_event");
-	shader = StaticCString::create("shader");
-	shader_unshaded = StaticCString::create("shader/unshaded");
-	shading_mode = StaticCString::create("shader/shading_mode");
-	tree_entered = StaticCString::create("tree_entered");
-	tree_exiting = StaticCString::create("tree_exiting");
-	tree_exited = StaticCString::create("tree_exited");
-	ready = StaticCString::create("ready");
-	item_rect_changed = StaticCString::create("item_rect_changed");
-	size_flags_changed = StaticCString::create("size_flags_changed");
-	minimum_size_changed = StaticCString::create("minimum_size_changed");
-	sleeping_state_changed = StaticCString::create("sleeping_state_changed");
+	resized = STATIC_SNAME("resized");
+	dot = STATIC_SNAME(".");
+	doubledot = STATIC_SNAME("..");
+	draw = STATIC_SNAME("draw");
+	_draw = STATIC_SNAME("_draw");
+	hide = STATIC_SNAME("hide");
+	visibility_changed = STATIC_SNAME("visibility_changed");
+	input_event = STATIC_SNAME("input_event");
+	shader = STATIC_SNAME("shader");
+	shader_unshaded = STATIC_SNAME("shader/unshaded");
+	shading_mode = STATIC_SNAME("shader/shading_mode");
+	tree_entered = STATIC_SNAME("tree_entered");
+	tree_exiting = STATIC_SNAME("tree_exiting");
+	tree_exited = STATIC_SNAME("tree_exited");
+	ready = STATIC_SNAME("ready");
+	item_rect_changed = STATIC_SNAME("item_rect_changed");
+	size_flags_changed = STATIC_SNAME("size_flags_changed");
+	minimum_size_changed = STATIC_SNAME("minimum_size_changed");
+	sleeping_state_changed = STATIC_SNAME("sleeping_state_changed");
 
-	finished = StaticCString::create("finished");
-	emission_finished = StaticCString::create("emission_finished");
-	animation_finished = StaticCString::create("animation_finished");
-	animation_changed = StaticCString::create("animation_changed");
-	animation_started = StaticCString::create("animation_started");
+	finished = STATIC_SNAME("finished");
+	emission_finished = STATIC_SNAME("emission_finished");
+	animation_finished = STATIC_SNAME("animation_finished");
+	animation_changed = STATIC_SNAME("animation_changed");
+	animation_started = STATIC_SNAME("animation_started");
 
-	pose_updated = StaticCString::create("pose_updated");
+	pose_updated = STATIC_SNAME("pose_updated");
 
-	mouse_entered = StaticCString::create("mouse_entered");
-	mouse_exited = StaticCString::create("mouse_exited");
+	mouse_entered = STATIC_SNAME("mouse_entered");
+	mouse_exited = STATIC_SNAME("mouse_exited");
 
-	focus_entered = StaticCString::create("focus_entered");
-	focus_exited = StaticCString::create("focus_exited");
+	focus_entered = STATIC_SNAME("focus_entered");
+	focus_exited = STATIC_SNAME("focus_exited");
 
-	sort_children = StaticCString::create("sort_children");
+	sort_children = STATIC_SNAME("sort_children");
 
-	body_shape_entered = StaticCString::create("body_shape_entered");
-	body_entered = StaticCString::create("body_entered");
-	body_shape_exited = StaticCString::create("body_shape_exited");
-	body_exited = StaticCString::create("body_exited");
+	body_shape_entered = STATIC_SNAME("body_shape_entered");
+	body_entered = STATIC_SNAME("body_entered");
+	body_shape_exited = STATIC_SNAME("body_shape_exited");
+	body_exited = STATIC_SNAME("body_exited");
 
-	area_shape_entered = StaticCString::create("area_shape_entered");
-	area_shape_exited = StaticCString::create("area_shape_exited");
+	area_shape_entered = STATIC_SNAME("area_shape_entered");
+	area_shape_exited = STATIC_SNAME("area_shape_exited");
 
-	_body_inout = StaticCString::create("_body_inout");
-	_area_inout = StaticCString::create("_area_inout");
+	_body_inout = STATIC_SNAME("_body_inout");
+	_area_inout = STATIC_SNAME("_area_inout");
 
-	idle = StaticCString::create("idle");
-	iteration = StaticCString::create("iteration");
-	update = StaticCString::create("update");
-	updated = StaticCString::create("updated");
+	idle = STATIC_SNAME("idle");
+	iteration = STATIC_SNAME("iteration");
+	update = STATIC_SNAME("update");
+	updated = STATIC_SNAME("updated");
 
-	_get_gizmo_geometry = StaticCString::create("_get_gizmo_geometry");
-	_can_gizmo_scale = StaticCString::create("_can_gizmo_scale");
+	_get_gizmo_geometry = STATIC_SNAME("_get_gizmo_geometry");
+	_can_gizmo_scale = STATIC_SNAME("_can_gizmo_scale");
 
-	_physics_process = StaticCString::create("_physics_process");
-	_process = StaticCString::create("_process");
+	_physics_process = STATIC_SNAME("_physics_process");
+	_process = STATIC_SNAME("_process");
+	idle_process = STATIC_SNAME("idle_process");
+	idle_process_internal = STATIC_SNAME("idle_process_internal");
+	physics_process = STATIC_SNAME("physics_process");
+	physics_process_internal = STATIC_SNAME("physics_process_internal");
 
-	_enter_tree = StaticCString::create("_enter_tree");
-	_exit_tree = StaticCString::create("_exit_tree");
-	_enter_world = StaticCString::create("_enter_world");
-	_exit_world = StaticCString::create("_exit_world");
-	_ready = StaticCString::create("_ready");
+	_enter_tree = STATIC_SNAME("_enter_tree");
+	_exit_tree = STATIC_SNAME("_exit_tree");
+	_enter_world = STATIC_SNAME("_enter_world");
+	_exit_world = STATIC_SNAME("_exit_world");
+	_ready = STATIC_SNAME("_ready");
 
-	_update_scroll = StaticCString::create("_update_scroll");
-	_update_xform = StaticCString::create("_update_xform");
+	_update_scroll = STATIC_SNAME("_update_scroll");
+	_update_xform = STATIC_SNAME("_update_xform");
 
-	_clips_input = StaticCString::create("_clips_input");
+	_clips_input = STATIC_SNAME("_clips_input");
 
-	_proxgroup_add = StaticCString::create("_proxgroup_add");
-	_proxgroup_remove = StaticCString::create("_proxgroup_remove");
+	_proxgroup_add = STATIC_SNAME("_proxgroup_add");
+	_proxgroup_remove = STATIC_SNAME("_proxgroup_remove");
 
-	grouped = StaticCString::create("grouped");
-	ungrouped = StaticCString::create("ungrouped");
+	grouped = STATIC_SNAME("grouped");
+	ungrouped = STATIC_SNAME("ungrouped");
 
-	screen_entered = StaticCString::create("screen_entered");
-	screen_exited = StaticCString::create("screen_exited");
+	screen_entered = STATIC_SNAME("screen_entered");
+	screen_exited = STATIC_SNAME("screen_exited");
 
-	viewport_entered = StaticCString::create("viewport_entered");
-	viewport_exited = StaticCString::create("viewport_exited");
+	viewport_entered = STATIC_SNAME("viewport_entered");
+	viewport_exited = STATIC_SNAME("viewport_exited");
 
-	camera_entered = StaticCString::create("camera_entered");
-	camera_exited = StaticCString::create("camera_exited");
+	camera_entered = STATIC_SNAME("camera_entered");
+	camera_exited = STATIC_SNAME("camera_exited");
 
-	_input = StaticCString::create("_input");
-	_input_event = StaticCString::create("_input_event");
+	_input = STATIC_SNAME("_input");
+	_input_event = STATIC_SNAME("_input_event");
 
-	gui_input = StaticCString::create("gui_input");
-	_gui_input = StaticCString::create("_gui_input");
+	gui_input = STATIC_SNAME("gui_input");
+	_gui_input = STATIC_SNAME("_gui_input");
 
-	_unhandled_input = StaticCString::create("_unhandled_input");
-	_unhandled_key_input = StaticCString::create("_unhandled_key_input");
+	_unhandled_input = STATIC_SNAME("_unhandled_input");
+	_unhandled_key_input = STATIC_SNAME("_unhandled_key_input");
 
-	changed = StaticCString::create("changed");
-	_shader_changed = StaticCString::create("_shader_changed");
+	changed = STATIC_SNAME("changed");
+	_shader_changed = STATIC_SNAME("_shader_changed");
 
-	_spatial_editor_group = StaticCString::create("_spatial_editor_group");
-	_request_gizmo = StaticCString::create("_request_gizmo");
+	_spatial_editor_group = STATIC_SNAME("_spatial_editor_group");
+	_request_gizmo = STATIC_SNAME("_request_gizmo");
 
-	offset = StaticCString::create("offset");
-	unit_offset = StaticCString::create("unit_offset");
-	rotation_mode = StaticCString::create("rotation_mode");
-	rotate = StaticCString::create("rotate");
-	h_offset = StaticCString::create("h_offset");
-	v_offset = StaticCString::create("v_offset");
+	offset = STATIC_SNAME("offset");
+	unit_offset = STATIC_SNAME("unit_offset");
+	rotation_mode = STATIC_SNAME("rotation_mode");
+	rotate = STATIC_SNAME("rotate");
+	h_offset = STATIC_SNAME("h_offset");
+	v_offset = STATIC_SNAME("v_offset");
 
-	transform_pos = StaticCString::create("position");
-	transform_rot = StaticCString::create("rotation_degrees");
-	transform_scale = StaticCString::create("scale");
+	transform_pos = STATIC_SNAME("position");
+	transform_rot = STATIC_SNAME("rotation_degrees");
+	transform_scale = STATIC_SNAME("scale");
 
-	_update_remote = StaticCString::create("_update_remote");
-	_update_pairs = StaticCString::create("_update_pairs");
+	_update_remote = STATIC_SNAME("_update_remote");
+	_update_pairs = STATIC_SNAME("_update_pairs");
 
-	_get_minimum_size = StaticCString::create("_get_minimum_size");
+	_get_minimum_size = STATIC_SNAME("_get_minimum_size");
 
-	area_entered = StaticCString::create("area_entered");
-	area_exited = StaticCString::create("area_exited");
+	area_entered = STATIC_SNAME("area_entered");
+	area_exited = STATIC_SNAME("area_exited");
 
-	has_point = StaticCString::create("has_point");
+	has_point = STATIC_SNAME("has_point");
 
-	line_separation = StaticCString::create("line_separation");
+	line_separation = STATIC_SNAME("line_separation");
 
-	get_drag_data = StaticCString::create("get_drag_data");
-	drop_data = StaticCString::create("drop_data");
-	can_drop_data = StaticCString::create("can_drop_data");
+	get_drag_data = STATIC_SNAME("get_drag_data");
+	drop_data = STATIC_SNAME("drop_data");
+	can_drop_data = STATIC_SNAME("can_drop_data");
 
-	_im_update = StaticCString::create("_im_update"); // Sprite3D
+	_im_update = STATIC_SNAME("_im_update"); // Sprite3D
 
-	baked_light_changed = StaticCString::create("baked_light_changed");
-	_baked_light_changed = StaticCString::create("_baked_light_changed");
+	baked_light_changed = STATIC_SNAME("baked_light_changed");
+	_baked_light_changed = STATIC_SNAME("_baked_light_changed");
 
-	_mouse_enter = StaticCString::create("_mouse_enter");
-	_mouse_exit = StaticCString::create("_mouse_exit");
+	_mouse_enter = STATIC_SNAME("_mouse_enter");
+	_mouse_exit = STATIC_SNAME("_mouse_exit");
 
-	_pressed = StaticCString::create("_pressed");
-	_toggled = StaticCString::create("_toggled");
+	_pressed = STATIC_SNAME("_pressed");
+	_toggled = STATIC_SNAME("_toggled");
 
-	frame_changed = StaticCString::create("frame_changed");
+	frame_changed = STATIC_SNAME("frame_changed");
 
-	playback_speed = StaticCString::create("playback/speed");
-	playback_active = StaticCString::create("playback/active");
-	autoplay = StaticCString::create("autoplay");
-	blend_times = StaticCString::create("blend_times");
-	speed = StaticCString::create("speed");
+	playback_speed = STATIC_SNAME("playback/speed");
+	playback_active = STATIC_SNAME("playback/active");
+	autoplay = STATIC_SNAME("autoplay");
+	blend_times = STATIC_SNAME("blend_times");
+	speed = STATIC_SNAME("speed");
 
-	node_configuration_warning_changed = StaticCString::create("node_configuration_warning_changed");
+	node_configuration_warning_changed = STATIC_SNAME("node_configuration_warning_changed");
 
-	output = StaticCString::create("output");
+	output = STATIC_SNAME("output");
 
 	path_pp = NodePath("..");
 
-	_default = StaticCString::create("default");
+	_default = STATIC_SNAME("default");
 
 	for (int i = 0; i < MAX_MATERIALS; i++) {
 		mesh_materials[i] = "material/" + itos(i);
 	}
 
-	_window_group = StaticCString::create("_window_group");
-	_window_input = StaticCString::create("_window_input");
-	window_input = StaticCString::create("window_input");
-	_window_unhandled_input = StaticCString::create("_window_unhandled_input");
+	_window_group = STATIC_SNAME("_window_group");
+	_window_input = STATIC_SNAME("_window_input");
+	window_input = STATIC_SNAME("window_input");
+	_window_unhandled_input = STATIC_SNAME("_window_unhandled_input");
 
-	theme_changed = StaticCString::create("theme_changed");
+	theme_changed = STATIC_SNAME("theme_changed");
 	parameters_base_path = "parameters/";
 
 	tracks_changed = "tracks_changed";
 
-	shader_overrides_group = StaticCString::create("_shader_overrides_group_");
-	shader_overrides_group_active = StaticCString::create("_shader_overrides_group_active_");
+	shader_overrides_group = STATIC_SNAME("_shader_overrides_group_");
+	shader_overrides_group_active = STATIC_SNAME("_shader_overrides_group_active_");
 
 #ifndef DISABLE_DEPRECATED
-	use_in_baked_light = StaticCString::create("use_in_baked_light");
-	use_dynamic_gi = StaticCString::create("use_dynamic_gi");
+	use_in_baked_light = STATIC_SNAME("use_in_baked_light");
+	use_dynamic_gi = STATIC_SNAME("use_dynamic_gi");
 #endif
 }
@@ -113,6 +113,10 @@ public:
 
 	StringName _physics_process;
 	StringName _process;
+	StringName idle_process;
+	StringName idle_process_internal;
+	StringName physics_process;
+	StringName physics_process_internal;
 	StringName _enter_world;
 	StringName _exit_world;
 	StringName _enter_tree;
@@ -303,11 +303,12 @@ void AudioServer::_mix_step() {
 			do {
 				if (bus != buses[0]) {
 					//everything has a send save for master bus
-					if (!bus_map.has(bus->send)) {
+					Map<StringName, Bus *>::Element *S = bus_map.find(bus->send);
+					if (!S) {
 						bus = buses[0]; //send to master
 					} else {
 						int prev_index_cache = bus->index_cache;
-						bus = bus_map[bus->send];
+						bus = S->get();
 						if (prev_index_cache >= bus->index_cache) { //invalid, send to master
 							bus = buses[0];
 						}
@@ -329,14 +330,18 @@ void AudioServer::_mix_step() {
 		E->get().callback(E->get().userdata);
 	}
 
+	const float disable_threshold = Math::db2linear(channel_disable_threshold_db);
+
 	for (int i = buses.size() - 1; i >= 0; i--) {
 		//go bus by bus
 		Bus *bus = buses[i];
+		Bus::Channel *channels = bus->channels.ptrw();
+		int channel_count = bus->channels.size();
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
+		for (int k = 0; k < channel_count; k++) {
+			if (channels[k].active && !channels[k].used) {
 				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+				AudioFrame *buf = channels[k].buffer.ptrw();
 
 				for (uint32_t j = 0; j < buffer_size; j++) {
 					buf[j] = AudioFrame(0, 0);
@@ -355,19 +360,19 @@ void AudioServer::_mix_step() {
 				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 #endif
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+				for (int k = 0; k < channel_count; k++) {
+					if (!(channels[k].active || channels[k].effect_instances[j]->process_silence())) {
 						continue;
 					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+					channels[k].effect_instances.write[j]->process(channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
 				}
 
 				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+				for (int k = 0; k < channel_count; k++) {
+					if (!(channels[k].active || channels[k].effect_instances[j]->process_silence())) {
 						continue;
 					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+					SWAP(channels[k].buffer, temp_buffer.write[k]);
 				}
 
 #ifdef DEBUG_ENABLED
@@ -382,60 +387,66 @@ void AudioServer::_mix_step() {
 
 		if (i > 0) {
 			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
+			Map<StringName, Bus *>::Element *S = bus_map.find(bus->send);
+			if (!S) {
 				send = buses[0];
 			} else {
-				send = bus_map[bus->send];
+				send = S->get();
 				if (send->index_cache >= bus->index_cache) { //invalid, send to master
 					send = buses[0];
 				}
 			}
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
+		float volume = Math::db2linear(bus->volume_db);
+
+		if (solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
+			}
+		}
+
+		for (int k = 0; k < channel_count; k++) {
+			if (!channels[k].active) {
 				continue;
 			}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+			AudioFrame *buf = channels[k].buffer.ptrw();
 
 			AudioFrame peak = AudioFrame(0, 0);
 
-			float volume = Math::db2linear(bus->volume_db);
-
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
+			//apply volume and compute peak
+			if (volume == 0.0) {
+				for (uint32_t j = 0; j < buffer_size; j++) {
+					buf[j] = AudioFrame(0, 0);
 				}
 			} else {
-				if (bus->mute) {
-					volume = 0.0;
+				// Plain loops with no branches, so the compiler can vectorize them.
+				if (volume != 1.0) {
+					for (uint32_t j = 0; j < buffer_size; j++) {
+						buf[j] *= volume;
+					}
 				}
-			}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
-
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
-				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
+				for (uint32_t j = 0; j < buffer_size; j++) {
+					peak.l = MAX(peak.l, ABS(buf[j].l));
+					peak.r = MAX(peak.r, ABS(buf[j].r));
 				}
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + 0.0000000001), Math::linear2db(peak.r + 0.0000000001));
+			channels[k].peak_volume = AudioFrame(Math::linear2db(peak.l + 0.0000000001), Math::linear2db(peak.r + 0.0000000001));
 
-			if (!bus->channels[k].used) {
+			if (!channels[k].used) {
 				//see if any audio is contained, because channel was not used
 
-				if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
+				if (MAX(peak.r, peak.l) > disable_threshold) {
+					channels[k].last_mix_with_audio = mix_frames;
+				} else if (mix_frames - channels[k].last_mix_with_audio > channel_disable_frames) {
+					channels[k].active = false;
 					continue; //went inactive, don't mix.
 				}
 			}
@@ -0,0 +1,93 @@
+/*************************************************************************/
+/*  test_json.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_JSON_H
+#define TEST_JSON_H
+
+#include "core/io/json.h"
+
+#include "tests/test_macros.h"
+
+namespace TestJSON {
+
+TEST_CASE("[JSON] Parse strings and identifiers") {
+	Variant result;
+	String err_str;
+	int err_line = 0;
+
+	Error err = JSON::parse("{\"name\": \"Godot\\nEngine \\u00e9!\", \"ok\": true, \"none\": null, \"list\": [1, -2.5, false]}", result, err_str, err_line);
+	REQUIRE(err == OK);
+	REQUIRE(result.get_type() == Variant::DICTIONARY);
+
+	Dictionary d = result;
+	CHECK(String(d["name"]) == String::utf8("Godot\nEngine é!"));
+	CHECK(bool(d["ok"]));
+	CHECK(d["none"].get_type() == Variant::NIL);
+
+	Array list = d["list"];
+	REQUIRE(list.size() == 3);
+	CHECK(double(list[0]) == 1.0);
+	CHECK(double(list[1]) == -2.5);
+	CHECK(!bool(list[2]));
+}
+
+TEST_CASE("[JSON] Parse errors") {
+	Variant result;
+	String err_str;
+	int err_line = 0;
+
+	CHECK(JSON::parse("{\"unterminated", result, err_str, err_line) != OK);
+	CHECK(JSON::parse("[nope]", result, err_str, err_line) != OK);
+	CHECK(JSON::parse("{\n\"a\": 1\n\"b\": 2}", result, err_str, err_line) != OK);
+	CHECK(err_line == 2);
+}
+
+TEST_CASE("[JSON] Print") {
+	Dictionary d;
+	d["b"] = "quote\"d";
+	d["a"] = Array();
+	Array inner;
+	inner.push_back(1);
+	inner.push_back(Variant());
+	d["c"] = inner;
+
+	CHECK(JSON::print(d) == "{\"a\":[],\"b\":\"quote\\\"d\",\"c\":[1,null]}");
+	CHECK(JSON::print(inner, "\t") == "[\n\t1,\n\tnull\n]");
+
+	Variant parsed;
+	String err_str;
+	int err_line = 0;
+	REQUIRE(JSON::parse(JSON::print(d, "  "), parsed, err_str, err_line) == OK);
+	CHECK(JSON::print(parsed) == JSON::print(d));
+}
+
+} // namespace TestJSON
+
+#endif // TEST_JSON_H
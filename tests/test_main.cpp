@@ -39,9 +39,11 @@
 #include "test_expression.h"
 #include "test_gradient.h"
 #include "test_gui.h"
+#include "test_json.h"
 #include "test_list.h"
 #include "test_math.h"
 #include "test_oa_hash_map.h"
+#include "test_object.h"
 #include "test_ordered_hash_map.h"
 #include "test_physics_2d.h"
 #include "test_physics_3d.h"
@@ -50,6 +52,7 @@
 #include "test_string.h"
 #include "test_validate_testing.h"
 #include "test_variant.h"
+#include "test_vector.h"
 
 #include "modules/modules_tests.gen.h"
 
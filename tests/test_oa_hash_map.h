@@ -31,11 +31,327 @@
 #ifndef TEST_OA_HASH_MAP_H
 #define TEST_OA_HASH_MAP_H
 
-#include "core/os/main_loop.h"
+#include "core/hash_map.h"
+#include "core/math/random_number_generator.h"
+#include "core/oa_hash_map.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
 
 namespace TestOAHashMap {
 
-MainLoop *test();
+TEST_CASE("[OAHashMap] Set, overwrite and lookup") {
+	OAHashMap<int, int> map;
+	map.set(42, 1337);
+	map.set(1337, 21);
+	map.set(42, 11880);
+
+	int value = 0;
+	CHECK(map.lookup(42, value));
+	CHECK(value == 11880);
+	CHECK(map.lookup_ptr(1337) != nullptr);
+	CHECK(*map.lookup_ptr(1337) == 21);
+	CHECK(map.lookup_ptr(7) == nullptr);
+	CHECK(map.get_num_elements() == 2);
+}
+
+TEST_CASE("[OAHashMap] Capacity is a power of two") {
+	OAHashMap<int, int> zero_map(0);
+	CHECK(zero_map.get_capacity() == 8);
+	zero_map.set(1, 1);
+	zero_map.set(2, 2);
+	CHECK(zero_map.has(1));
+	CHECK(zero_map.has(2));
+
+	OAHashMap<int, int> map(100);
+	CHECK(map.get_capacity() == 128);
+
+	map.reserve(129);
+	CHECK(map.get_capacity() == 256);
+
+	for (int i = 0; i < 1000; i++) {
+		map.set(i, i);
+	}
+	CHECK((map.get_capacity() & (map.get_capacity() - 1)) == 0);
+	CHECK(map.get_num_elements() * 8 <= map.get_capacity() * 7);
+}
+
+TEST_CASE("[OAHashMap] Small maps keep a free position") {
+	for (uint32_t initial_capacity = 0; initial_capacity <= 8; initial_capacity++) {
+		OAHashMap<int, int> map(initial_capacity);
+		for (int i = 0; i < 32; i++) {
+			map.set(i * 8, i);
+			CHECK(map.get_num_elements() < map.get_capacity());
+		}
+		// A missing key must end probing on a free position.
+		CHECK_FALSE(map.has(1));
+	}
+}
+
+TEST_CASE("[OAHashMap] Rehashing and deletion") {
+	OAHashMap<int, int> map;
+
+	for (int i = 0; i < 500; i++) {
+		map.set(i, i * 2);
+	}
+
+	for (int i = 0; i < 500; i += 2) {
+		map.remove(i);
+	}
+
+	bool valid = true;
+	for (int i = 0; i < 500; i++) {
+		int value = 0;
+		bool found = map.lookup(i, value);
+		if (found != (i % 2 == 1) || (found && value != i * 2)) {
+			valid = false;
+		}
+	}
+	CHECK(valid);
+	CHECK(map.get_num_elements() == 250);
 }
 
+TEST_CASE("[OAHashMap] Random operations match HashMap") {
+	OAHashMap<uint32_t, int> map;
+	HashMap<uint32_t, int> reference;
+
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	for (int i = 0; i < 10000; i++) {
+		uint32_t key = rng.randi() % 2000;
+		if (rng.randi() % 3 == 0) {
+			map.remove(key);
+			reference.erase(key);
+		} else {
+			map.set(key, i);
+			reference[key] = i;
+		}
+	}
+
+	CHECK(map.get_num_elements() == uint32_t(reference.size()));
+
+	bool valid = true;
+	for (uint32_t key = 0; key < 2000; key++) {
+		const int *expected = reference.getptr(key);
+		int *value = map.lookup_ptr(key);
+		if ((expected == nullptr) != (value == nullptr) || (expected && *expected != *value)) {
+			valid = false;
+		}
+	}
+	CHECK(valid);
+}
+
+TEST_CASE("[OAHashMap] Random keys stay present (issue #22928)") {
+	OAHashMap<uint32_t, int> map;
+	Vector<uint32_t> keys;
+
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	for (int i = 0; i < 1000; i++) {
+		uint32_t key = rng.randi();
+		keys.push_back(key);
+		map.set(key, 0);
+		CHECK(map.has(key));
+	}
+
+	bool valid = true;
+	for (int i = 0; i < keys.size(); i++) {
+		if (!map.has(keys[i])) {
+			valid = false;
+		}
+	}
+	CHECK(valid);
+}
+
+TEST_CASE("[OAHashMap] Colliding keys (issue #31402)") {
+	OAHashMap<int, int> map;
+	const int test_values[12] = { 0, 24, 48, 72, 96, 120, 144, 168, 192, 216, 240, 264 };
+	for (int i = 0; i < 12; i++) {
+		map.set(test_values[i], 0);
+	}
+	for (int i = 0; i < 12; i++) {
+		CHECK(map.has(test_values[i]));
+	}
+
+	// Should not crash or run indefinitely.
+	OAHashMap<int, int> small_map(4);
+	small_map.set(1, 1);
+	small_map.set(5, 1);
+	small_map.set(9, 1);
+	small_map.set(13, 1);
+	small_map.remove(5);
+	small_map.remove(9);
+	small_map.remove(13);
+	small_map.set(5, 1);
+	CHECK(small_map.has(1));
+	CHECK(small_map.has(5));
+	CHECK(small_map.get_num_elements() == 2);
+}
+
+struct CountedItem {
+	static int count;
+
+	int id = -1;
+	bool destroyed = false;
+
+	CountedItem() {
+		count++;
+	}
+
+	CountedItem(int p_id) :
+			id(p_id) {
+		count++;
+	}
+
+	CountedItem(const CountedItem &p_other) :
+			id(p_other.id) {
+		count++;
+	}
+
+	CountedItem &operator=(const CountedItem &p_other) = default;
+
+	~CountedItem() {
+		CRASH_COND(destroyed);
+		count--;
+		destroyed = true;
+	}
+};
+
+int CountedItem::count = 0;
+
+TEST_CASE("[OAHashMap] Items are destroyed") {
+	// Exercise different patterns of removal.
+	for (int i = 0; i < 4; i++) {
+		{
+			OAHashMap<String, CountedItem> map;
+			for (int j = 0; j < 100; j++) {
+				map.insert(itos(j), CountedItem(j));
+			}
+			if (i <= 1) {
+				for (int j = 0; j < 100; j++) {
+					map.remove(itos(j));
+				}
+			}
+			if (i % 2 == 0) {
+				map.clear();
+			}
+		}
+		CHECK(CountedItem::count == 0);
+	}
+}
+
+TEST_CASE("[OAHashMap] Iteration") {
+	OAHashMap<String, int> map;
+	map.set("Hello", 1);
+	map.set("World", 2);
+	map.set("Godot rocks", 42);
+
+	int count = 0;
+	int sum = 0;
+	for (OAHashMap<String, int>::Iterator it = map.iter(); it.valid; it = map.next_iter(it)) {
+		CHECK(*map.lookup_ptr(*it.key) == *it.value);
+		count++;
+		sum += *it.value;
+	}
+	CHECK(count == 3);
+	CHECK(sum == 45);
+}
+
+TEST_CASE("[OAHashMap] Copy and assignment") {
+	OAHashMap<int, String> original_map;
+	for (int i = 1; i <= 5; i++) {
+		original_map.set(i, itos(i));
+	}
+
+	OAHashMap<int, String> map_copy(original_map);
+	OAHashMap<int, String> map_assigned(100000);
+	map_assigned.set(1, "Just a string.");
+	map_assigned = original_map;
+
+	for (int i = 1; i <= 5; i++) {
+		CHECK(*map_copy.lookup_ptr(i) == itos(i));
+		CHECK(*map_assigned.lookup_ptr(i) == itos(i));
+	}
+
+	map_copy.set(1, "Random String");
+	map_assigned.set(1, "Random String");
+	CHECK(*original_map.lookup_ptr(1) == "1");
+}
+
+// Timings vary too much between runs and machines to be checked in a test case,
+// run with `godot --test oa-hash-map-benchmark` instead.
+void benchmark() {
+	const int count = 1000000;
+
+	Vector<uint32_t> keys;
+	keys.resize(count);
+	RandomNumberGenerator rng;
+	rng.set_seed(0);
+	for (int i = 0; i < count; i++) {
+		keys.write[i] = rng.randi();
+	}
+	const uint32_t *k = keys.ptr();
+
+	OS *os = OS::get_singleton();
+	uint64_t sum = 0;
+
+	{
+		OAHashMap<uint32_t, int> map;
+
+		uint64_t begin = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.set(k[i], i);
+		}
+		uint64_t insert_usec = os->get_ticks_usec() - begin;
+
+		begin = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			// Every other lookup misses.
+			int *value = map.lookup_ptr(i & 1 ? k[i] : k[i] + 1);
+			sum += value ? *value : 0;
+		}
+		uint64_t lookup_usec = os->get_ticks_usec() - begin;
+
+		begin = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.remove(k[i]);
+		}
+		uint64_t erase_usec = os->get_ticks_usec() - begin;
+
+		print_line(vformat("OAHashMap: insert %d usec, lookup %d usec, erase %d usec.", insert_usec, lookup_usec, erase_usec));
+	}
+
+	{
+		HashMap<uint32_t, int> map;
+
+		uint64_t begin = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map[k[i]] = i;
+		}
+		uint64_t insert_usec = os->get_ticks_usec() - begin;
+
+		begin = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			int *value = map.getptr(i & 1 ? k[i] : k[i] + 1);
+			sum += value ? *value : 0;
+		}
+		uint64_t lookup_usec = os->get_ticks_usec() - begin;
+
+		begin = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.erase(k[i]);
+		}
+		uint64_t erase_usec = os->get_ticks_usec() - begin;
+
+		print_line(vformat("HashMap: insert %d usec, lookup %d usec, erase %d usec.", insert_usec, lookup_usec, erase_usec));
+	}
+
+	// Keeps the lookups from being optimized out.
+	print_line(vformat("Checksum: %d", sum));
+}
+
+REGISTER_TEST_COMMAND("oa-hash-map-benchmark", &benchmark);
+
+} // namespace TestOAHashMap
+
 #endif // TEST_OA_HASH_MAP_H
@@ -0,0 +1,101 @@
+/*************************************************************************/
+/*  test_object.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_OBJECT_H
+#define TEST_OBJECT_H
+
+#include "core/callable_method_pointer.h"
+#include "core/object.h"
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestObject {
+
+class SignalReceiver : public Object {
+public:
+	int calls = 0;
+	int bind_sum = 0;
+	uint64_t mem_usage = 0;
+
+	void on_signal() {
+		calls++;
+		mem_usage = Memory::get_mem_usage();
+	}
+
+	void on_signal_bind(int p_value) {
+		calls++;
+		bind_sum += p_value;
+		mem_usage = Memory::get_mem_usage();
+	}
+};
+
+TEST_CASE("[Object] Emitting a signal calls every connection") {
+	Object emitter;
+	SignalReceiver receiver;
+	const StringName signal = "test_signal";
+	emitter.add_user_signal(MethodInfo(signal));
+
+	Vector<Variant> binds;
+	binds.push_back(5);
+	CHECK(emitter.connect(signal, callable_mp(&receiver, &SignalReceiver::on_signal)) == OK);
+	CHECK(emitter.connect(signal, callable_mp(&receiver, &SignalReceiver::on_signal_bind), binds) == OK);
+
+	for (int i = 0; i < 3; i++) {
+		CHECK(emitter.emit_signal(signal) == OK);
+	}
+	CHECK(receiver.calls == 6);
+	CHECK(receiver.bind_sum == 15);
+}
+
+TEST_CASE("[Object] Emitting a signal doesn't duplicate its connections") {
+	Object emitter;
+	SignalReceiver receiver;
+	const StringName signal = "test_signal";
+	emitter.add_user_signal(MethodInfo(signal));
+
+	Vector<Variant> binds;
+	binds.push_back(1);
+	emitter.connect(signal, callable_mp(&receiver, &SignalReceiver::on_signal));
+	emitter.connect(signal, callable_mp(&receiver, &SignalReceiver::on_signal_bind), binds);
+
+	for (int i = 0; i < 10; i++) {
+		// The slot list is shared with the emission, not copied, so nothing is allocated
+		// by the time the connected methods are called.
+		uint64_t before = Memory::get_mem_usage();
+		emitter.emit_signal(signal);
+		CHECK(receiver.mem_usage == before);
+	}
+	CHECK(receiver.calls == 20);
+}
+
+} // namespace TestObject
+
+#endif // TEST_OBJECT_H
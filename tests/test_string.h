@@ -38,6 +38,7 @@
 #include "core/io/ip_address.h"
 #include "core/os/main_loop.h"
 #include "core/os/os.h"
+#include "core/string_name.h"
 #include "core/ustring.h"
 
 #ifdef MODULE_REGEX_ENABLED
@@ -111,6 +112,19 @@ TEST_CASE("[String] UTF8") {
 	CHECK(String::utf8(cs) == s);
 }
 
+TEST_CASE("[String] UTF8 ASCII only") {
+	String s = "Godot Engine";
+	CharString cs = s.utf8();
+	CHECK(cs.length() == s.length());
+	CHECK(strcmp(cs.get_data(), "Godot Engine") == 0);
+
+	String parsed;
+	bool err = parsed.parse_utf8(cs.get_data());
+	CHECK(!err);
+	CHECK(parsed == s);
+	CHECK(String::utf8("Godot", 3) == "God");
+}
+
 TEST_CASE("[String] UTF16") {
 	/* how can i embed UTF in here? */
 	static const char32_t u32str[] = { 0x0045, 0x0020, 0x304A, 0x360F, 0x3088, 0x3046, 0x1F3A4, 0 };
@@ -310,6 +324,9 @@ TEST_CASE("[String] Find") {
 	CHECK(s.find("tty") == 3);
 	CHECK(s.find("Wo", 9) == 13);
 	CHECK(s.find("Revenge of the Monster Truck") == -1);
+	CHECK(s.find(String("Woman")) == 7);
+	CHECK(s.find(String("Woman"), 8) == 13);
+	CHECK(s.find(String("Womanly")) == -1);
 	CHECK(s.rfind("man") == 15);
 }
 
@@ -1297,6 +1314,21 @@ TEST_CASE("[String] humanize_size") {
 	CHECK(String::humanize_size(5345555000) == "4.97 GiB");
 }
 
+TEST_CASE("[StringName] Static names hashed at compile time") {
+	static_assert(StringName::hash_static("") == 5381, "Hash of an empty string must be the djb2 seed.");
+
+	const char *names[3] = { "ready", "shader/unshaded", "caf\xc3\xa9" };
+	for (int i = 0; i < 3; i++) {
+		CHECK(StringName::hash_static(names[i]) == String::hash(names[i]));
+		CHECK(StringName::hash_static(names[i]) == String(names[i]).hash());
+	}
+
+	StringName ready = STATIC_SNAME("ready");
+	CHECK(ready == StringName("ready"));
+	CHECK(ready.hash() == String("ready").hash());
+	CHECK(STATIC_SNAME("caf\xc3\xa9") == StringName(String("caf\xc3\xa9")));
+}
+
 } // namespace TestString
 
 #endif // TEST_STRING_H
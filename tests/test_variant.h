@@ -106,6 +106,56 @@ TEST_CASE("[Variant] Writer and parser float") {
 	CHECK_MESSAGE(b64_float_parsed == 340282001837565597733306976381245063168.0, "Should not overflow.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays") {
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant parsed;
+
+	ss.s = "PackedFloat32Array( 1, -2.5, 3e2,\n4 )";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	Vector<float> floats = parsed;
+	REQUIRE(floats.size() == 4);
+	CHECK(floats[0] == 1);
+	CHECK(floats[1] == -2.5);
+	CHECK(floats[2] == 300);
+	CHECK(floats[3] == 4);
+	CHECK(line == 2);
+
+	ss.s = "PackedInt64Array( 9223372036854775807, -3 )";
+	ss.pos = 0;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	Vector<int64_t> ints = parsed;
+	REQUIRE(ints.size() == 2);
+	CHECK(ints[0] == 9223372036854775807);
+	CHECK(ints[1] == -3);
+
+	ss.s = "PackedVector3Array( 1, 2, 3, -4, 5.5, 6, 7 )";
+	ss.pos = 0;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	Vector<Vector3> vectors = parsed;
+	// The incomplete trailing vector is dropped.
+	REQUIRE(vectors.size() == 2);
+	CHECK(vectors[0] == Vector3(1, 2, 3));
+	CHECK(vectors[1] == Vector3(-4, 5.5, 6));
+
+	ss.s = "PackedColorArray( 0, 0.5, 1, 1 )";
+	ss.pos = 0;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	Vector<Color> colors = parsed;
+	REQUIRE(colors.size() == 1);
+	CHECK(colors[0] == Color(0, 0.5, 1, 1));
+
+	ss.s = "PackedVector2Array( )";
+	ss.pos = 0;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	CHECK(Vector<Vector2>(parsed).size() == 0);
+
+	ss.s = "PackedFloat32Array( 1, \"2\" )";
+	ss.pos = 0;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == ERR_PARSE_ERROR);
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H
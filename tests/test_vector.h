@@ -0,0 +1,141 @@
+/*************************************************************************/
+/*  test_vector.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_VECTOR_H
+#define TEST_VECTOR_H
+
+#include "core/vector.h"
+
+#include "tests/test_macros.h"
+
+#include <utility>
+
+namespace TestVector {
+
+static Vector<int> make_vector(int p_size) {
+	Vector<int> vector;
+	for (int i = 0; i < p_size; i++) {
+		vector.push_back(i);
+	}
+	return vector;
+}
+
+TEST_CASE("[Vector] Move construction and assignment") {
+	Vector<int> source = make_vector(4);
+	const int *buffer = source.ptr();
+
+	Vector<int> constructed(std::move(source));
+	CHECK(constructed.ptr() == buffer);
+	CHECK(constructed.size() == 4);
+	CHECK(constructed[3] == 3);
+
+	Vector<int> assigned = make_vector(2);
+	assigned = std::move(constructed);
+	CHECK(assigned.ptr() == buffer);
+	CHECK(assigned.size() == 4);
+
+	// Sole owner of the buffer, so writing doesn't copy it.
+	assigned.write[0] = 10;
+	CHECK(assigned.ptr() == buffer);
+}
+
+TEST_CASE("[Vector] Moved-from vector is empty and usable") {
+	Vector<int> source = make_vector(4);
+	Vector<int> target(std::move(source));
+
+	CHECK(source.size() == 0);
+	CHECK(source.ptr() == nullptr);
+	source.push_back(42);
+	CHECK(source.size() == 1);
+	CHECK(source[0] == 42);
+	CHECK(target.size() == 4);
+
+	Vector<int> other = make_vector(3);
+	target = std::move(other);
+	CHECK(other.size() == 0);
+	CHECK(target.size() == 3);
+}
+
+TEST_CASE("[Vector] Moving empty vectors") {
+	Vector<int> empty;
+	Vector<int> constructed(std::move(empty));
+	CHECK(constructed.size() == 0);
+	CHECK(empty.size() == 0);
+
+	Vector<int> assigned = make_vector(3);
+	assigned = std::move(constructed);
+	CHECK(assigned.size() == 0);
+	CHECK(assigned.ptr() == nullptr);
+
+	Vector<int> other_empty;
+	assigned = std::move(other_empty);
+	CHECK(assigned.size() == 0);
+}
+
+TEST_CASE("[Vector] Self-move assignment") {
+	Vector<int> vector = make_vector(4);
+	const int *buffer = vector.ptr();
+
+	// Through a reference, so compilers don't warn about the self-move.
+	Vector<int> &same = vector;
+	vector = std::move(same);
+	CHECK(vector.ptr() == buffer);
+	CHECK(vector.size() == 4);
+	CHECK(vector[2] == 2);
+}
+
+TEST_CASE("[Vector] Moving between vectors sharing a buffer") {
+	Vector<int> a = make_vector(4);
+	Vector<int> b = a;
+	Vector<int> c = a;
+	const int *buffer = a.ptr();
+
+	// Three references, moving b into a must leave two: a and c.
+	a = std::move(b);
+	CHECK(b.size() == 0);
+	CHECK(a.ptr() == buffer);
+	CHECK(c.ptr() == buffer);
+	CHECK(a[3] == 3);
+
+	// a still shares with c, so writing to it copies.
+	a.write[0] = 10;
+	CHECK(a.ptr() != buffer);
+	CHECK(c[0] == 0);
+
+	// c is now the only owner, writing doesn't copy.
+	c.write[0] = 20;
+	CHECK(c.ptr() == buffer);
+	CHECK(c[0] == 20);
+	CHECK(a[0] == 10);
+}
+
+} // namespace TestVector
+
+#endif // TEST_VECTOR_H